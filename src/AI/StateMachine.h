@@ -0,0 +1,249 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_STATEMACHINE_H
+#define SUPERPACMAN_STATEMACHINE_H
+
+#include "Common/Events.h"
+#include <IME/core/time/Time.h>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace spm {
+    /**
+     * @brief A single row of a state transition table
+     * @tparam From The state the transition leaves
+     * @tparam Event The event that triggers the transition
+     * @tparam To The state the transition enters
+     */
+    template <typename From, GameEvent Event, typename To>
+    struct Transition {
+        using Source = From;
+        using Target = To;
+        static constexpr GameEvent Trigger = Event;
+    };
+
+    namespace detail {
+        ///////////////////////////////////////////////////////////////
+        template <typename T, typename... Ts>
+        inline constexpr bool isOneOf = (std::is_same_v<T, Ts> || ...);
+
+        ///////////////////////////////////////////////////////////////
+        template <typename From, GameEvent Event, typename... Transitions>
+        struct FindTarget {
+            using type = void;
+        };
+
+        ///////////////////////////////////////////////////////////////
+        template <typename From, GameEvent Event, typename First, typename... Rest>
+        struct FindTarget<From, Event, First, Rest...> {
+            using type = std::conditional_t<std::is_same_v<From, typename First::Source> && First::Trigger == Event,
+                typename First::Target, typename FindTarget<From, Event, Rest...>::type>;
+        };
+    }
+
+    /**
+     * @brief Compile-time state transition table
+     * @tparam Transitions The rows of the table (spm::Transition)
+     *
+     * An event that has no row for the current state is still passed to
+     * the state, but it does not cause a transition
+     */
+    template <typename... Transitions>
+    struct TransitionTable {
+        /**
+         * @brief The state entered when @a Event occurs in state @a From
+         *
+         * This type is @a void if @a Event does not cause a transition
+         * out of @a From
+         */
+        template <typename From, GameEvent Event>
+        using TargetOf = typename detail::FindTarget<From, Event, Transitions...>::type;
+
+        /**
+         * @brief The number of rows that leave @a From when @a Event occurs
+         */
+        template <typename From, GameEvent Event>
+        static constexpr int RowCount = ((std::is_same_v<From, typename Transitions::Source> && Transitions::Trigger == Event) + ... + 0);
+
+        /**
+         * @brief True if every row leaves and enters one of @a States
+         */
+        template <typename... States>
+        static constexpr bool RefersOnlyTo = ((detail::isOneOf<typename Transitions::Source, States...> &&
+            detail::isOneOf<typename Transitions::Target, States...>) && ...);
+
+        /**
+         * @brief True if no state has two rows for the same event
+         */
+        static constexpr bool IsDeterministic = ((RowCount<typename Transitions::Source, Transitions::Trigger> == 1) && ...);
+    };
+
+    /**
+     * @brief Finite state machine whose states are stored by value
+     * @tparam Owner The object whose behavior is defined by the states
+     * @tparam Table The transition table (spm::TransitionTable)
+     * @tparam States The states the machine can be in
+     *
+     * Every state must be default constructible and provide the following
+     * functions (they are looked up statically, not through a vtable):
+     *
+     * @code
+     * void onEntry(Owner& owner);
+     * void update(Owner& owner, ime::Time deltaTime);
+     * void handleEvent(Owner& owner, GameEvent event);
+     * void onExit(Owner& owner);
+     * @endcode
+     *
+     * The table is validated when the machine is instantiated, a row that
+     * refers to an unknown state or a state with two rows for the same
+     * event is a compile error. Since the set of states is closed, event
+     * dispatch is a std::visit over the current state followed by a
+     * transition that is resolved at compile time
+     */
+    template <typename Owner, typename Table, typename... States>
+    class StateMachine {
+        static_assert(sizeof...(States) > 0, "A state machine must have at least one state");
+        static_assert(Table::template RefersOnlyTo<States...>, "Transition table refers to a state that is not in the state machine");
+        static_assert(Table::IsDeterministic, "Transition table has more than one transition for the same state and event");
+
+    public:
+        /**
+         * @brief Constructor
+         * @param owner The object whose behavior is defined by the states
+         *
+         * The machine is initially not in any state
+         */
+        explicit StateMachine(Owner& owner) :
+            owner_{owner}
+        {}
+
+        /**
+         * @brief Exit the current state and enter a new one
+         * @tparam State The state to enter
+         * @param args The arguments of the constructor of @a State
+         *
+         * The state is entered even if the machine is already in it
+         */
+        template <typename State, typename... Args>
+        void transitionTo(Args&&... args) {
+            static_assert(detail::isOneOf<State, States...>, "State is not in the state machine");
+            exitCurrentState();
+            std::get<State>(state_ = State(std::forward<Args>(args)...)).onEntry(owner_);
+        }
+
+        /**
+         * @brief Destroy the current state without exiting it
+         */
+        void clear() {
+            state_ = std::monostate{};
+        }
+
+        /**
+         * @brief Check if the machine is in a given state
+         * @tparam State The state to be checked
+         * @return True if the machine is in @a State, otherwise false
+         */
+        template <typename State>
+        bool isIn() const {
+            return std::holds_alternative<State>(state_);
+        }
+
+        /**
+         * @brief Check if the machine is in any state
+         * @return True if not in any state, otherwise false
+         */
+        bool isEmpty() const {
+            return std::holds_alternative<std::monostate>(state_);
+        }
+
+        /**
+         * @brief Update the current state
+         * @param deltaTime Time passed since last update
+         */
+        void update(ime::Time deltaTime) {
+            std::visit([this, deltaTime](auto& state) {
+                if constexpr (!std::is_same_v<std::decay_t<decltype(state)>, std::monostate>)
+                    state.update(owner_, deltaTime);
+            }, state_);
+        }
+
+        /**
+         * @brief Pass an event to the current state
+         * @param event The event to be handled
+         *
+         * The current state handles the event first. If the transition
+         * table has a row for the current state and @a event, the machine
+         * then transitions to the state given by that row
+         */
+        void handleEvent(GameEvent event) {
+            dispatch(event, AllGameEvents{});
+        }
+
+    private:
+        /**
+         * @brief Convert a runtime event to a compile-time one
+         */
+        template <GameEvent... Events>
+        void dispatch(GameEvent event, GameEventList<Events...>) {
+            ((event == Events ? (react<Events>(), true) : false) || ...);
+        }
+
+        /**
+         * @brief Let the current state react to an event
+         */
+        template <GameEvent Event>
+        void react() {
+            std::visit([this](auto& state) {
+                using Current = std::decay_t<decltype(state)>;
+
+                if constexpr (!std::is_same_v<Current, std::monostate>) {
+                    state.handleEvent(owner_, Event);
+
+                    // Note: @a state is destroyed by the transition and must not be accessed after it
+                    using Next = typename Table::template TargetOf<Current, Event>;
+                    if constexpr (!std::is_void_v<Next>)
+                        transitionTo<Next>();
+                }
+            }, state_);
+        }
+
+        /**
+         * @brief Call the exit function of the current state
+         */
+        void exitCurrentState() {
+            std::visit([this](auto& state) {
+                if constexpr (!std::is_same_v<std::decay_t<decltype(state)>, std::monostate>)
+                    state.onExit(owner_);
+            }, state_);
+        }
+
+    private:
+        Owner& owner_;                                //!< The object whose behavior is defined by the states
+        std::variant<std::monostate, States...> state_; //!< The current state
+    };
+}
+
+#endif
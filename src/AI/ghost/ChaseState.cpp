@@ -23,8 +23,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "ChaseState.h"
-#include "ScatterState.h"
-#include "FrightenedState.h"
+#include "GameObjects/Ghost.h"
+#include "PathFinders/GhostGridMover.h"
 #include "Common/ObjectReferenceKeeper.h"
 #include "Common/Constants.h"
 #include "Utils/Utils.h"
@@ -38,37 +38,42 @@ namespace spm {
     {}
 
     ///////////////////////////////////////////////////////////////
-    void ChaseState::onEntry() {
-        ghost_->ime::GameObject::setState(static_cast<int>(Ghost::State::Chase));
-        GhostState::onEntry();
+    void ChaseState::onEntry(Ghost& ghost) {
+        ghost.ime::GameObject::setState(static_cast<int>(Ghost::State::Chase));
+        GhostState::onEntry(ghost);
 
-        ghost_->getSprite().getAnimator().startAnimation("going" + utils::convertToString(ghost_->getDirection()) + (ghost_->isFlat() ? "Flat" : ""));
-        adjMoveHandlerID_ = gridMover_->onMoveEnd(std::bind(&ChaseState::chasePacman, this));
-        gridMover_->startMovement();
+        GhostGridMover& gridMover = getGridMover(ghost);
+        ghost.getSprite().getAnimator().startAnimation("going" + utils::convertToString(ghost.getDirection()) + (ghost.isFlat() ? "Flat" : ""));
+        adjMoveHandlerID_ = gridMover.onMoveEnd([this, &ghost](ime::Index) {
+            chasePacman(ghost);
+        });
+
+        gridMover.startMovement();
 
         if (static_cast<PacMan*>(ObjectReferenceKeeper::getActor("pacman"))->getState() == PacMan::State::Super)
-            gridMover_->setMoveStrategy(GhostGridMover::Strategy::Random);
+            gridMover.setMoveStrategy(GhostGridMover::Strategy::Random);
         else
-            chasePacman();
+            chasePacman(ghost);
     }
 
     ///////////////////////////////////////////////////////////////
-    void ChaseState::chasePacman() {
+    void ChaseState::chasePacman(Ghost& ghost) {
+        GhostGridMover& gridMover = getGridMover(ghost);
         ime::GridObject* pacman = ObjectReferenceKeeper::getActor("pacman");
         ime::Index pacmanTile = pacman->getGridMover()->getCurrentTileIndex();
         ime::Vector2i pacmanDir = pacman->getGridMover()->getDirection();
 
-        if (ghost_->getTag() == "blinky")
-            gridMover_->setTargetTile(pacmanTile);
-        else if (ghost_->getTag() == "pinky") {
+        if (ghost.getTag() == "blinky")
+            gridMover.setTargetTile(pacmanTile);
+        else if (ghost.getTag() == "pinky") {
             auto targetTile = ime::Index{pacmanTile.row + 4 * pacmanDir.y, pacmanTile.colm + 4 * pacmanDir.x};
 
             // Mimic the overflow error
             if (pacmanDir == ime::Up)
                 targetTile.colm -= 4;
 
-            gridMover_->setTargetTile(targetTile);
-        } else if (ghost_->getTag() == "inky") {
+            gridMover.setTargetTile(targetTile);
+        } else if (ghost.getTag() == "inky") {
             ime::GridObject* blinky = ObjectReferenceKeeper::getActor("blinky");
             assert(blinky && "Inky cannot enter chase state without blinky in the maze");
             ime::Index blinkyTile = blinky->getGridMover()->getCurrentTileIndex();
@@ -86,42 +91,39 @@ namespace spm {
             // Flip vector 180 degrees
             ime::Index inkyTargetTile = ime::Index{pacmanTileOffset.row - pacmanTileOffsetToBlinkyVector.row, pacmanTileOffset.colm - pacmanTileOffsetToBlinkyVector.colm};
 
-            gridMover_->setTargetTile(inkyTargetTile);
+            gridMover.setTargetTile(inkyTargetTile);
 
-        } else if (ghost_->getTag() == "clyde") {
+        } else if (ghost.getTag() == "clyde") {
             const static int CLYDE_SHYNESS_DISTANCE = 8; // Distance in tiles not pixels
-            ime::Index clydeTile = ghost_->getGridMover()->getCurrentTileIndex();
+            ime::Index clydeTile = ghost.getGridMover()->getCurrentTileIndex();
 
             if (std::sqrt(std::pow(pacmanTile.row - clydeTile.row, 2.0) + std::pow(pacmanTile.colm - clydeTile.colm, 2.0)) > CLYDE_SHYNESS_DISTANCE)
-                gridMover_->setTargetTile(pacmanTile);
+                gridMover.setTargetTile(pacmanTile);
             else
-                gridMover_->setTargetTile(Constants::CLYDE_SCATTER_TARGET_TILE);
+                gridMover.setTargetTile(Constants::CLYDE_SCATTER_TARGET_TILE);
         } else {
             assert("Failed to create ghost chase strategy: Invalid tag");
         }
     }
 
     ///////////////////////////////////////////////////////////////
-    void ChaseState::handleEvent(GameEvent event, const ime::PropertyContainer &args) {
-        GhostState::handleEvent(event, args);
+    void ChaseState::handleEvent(Ghost& ghost, GameEvent event) {
+        GhostState::handleEvent(ghost, event);
 
+        // Transitions are defined in spm::GhostTransitionTable
         if (event == GameEvent::SuperModeBegin) {
-            gridMover_->setMoveStrategy(GhostGridMover::Strategy::Random);
-            ghost_->setFlattened(true);
+            getGridMover(ghost).setMoveStrategy(GhostGridMover::Strategy::Random);
+            ghost.setFlattened(true);
         } else if (event == GameEvent::SuperModeEnd) {
-            gridMover_->setMoveStrategy(GhostGridMover::Strategy::Target);
-            ghost_->setFlattened(false);
-        } else if (event == GameEvent::FrightenedModeBegin)
-            ghost_->setState(std::make_unique<FrightenedState>(Ghost::State::Chase));
-        else if (event == GameEvent::ScatterModeBegin) {
-            reverseDirection();
-            ghost_->setState(std::make_unique<ScatterState>());
-        }
+            getGridMover(ghost).setMoveStrategy(GhostGridMover::Strategy::Target);
+            ghost.setFlattened(false);
+        } else if (event == GameEvent::ScatterModeBegin)
+            reverseDirection(ghost);
     }
 
     ///////////////////////////////////////////////////////////////
-    void ChaseState::onExit() {
-        gridMover_->removeEventListener(adjMoveHandlerID_);
+    void ChaseState::onExit(Ghost& ghost) {
+        getGridMover(ghost).removeEventListener(adjMoveHandlerID_);
     }
 
 } // namespace pm
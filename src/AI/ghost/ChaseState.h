@@ -40,32 +40,35 @@ namespace spm {
 
         /**
          * @brief Initialize the state
+         * @param ghost The ghost whose behavior is defined by the state
          *
          * This function will be called by the FSM when a state is entered
          * for the first time
          */
-        void onEntry() override;
+        void onEntry(Ghost& ghost);
 
         /**
          * @brief Handle a game event
+         * @param ghost The ghost whose behavior is defined by the state
          * @param event The event to be handled
-         * @param args Arguments associated with the event
          */
-        void handleEvent(GameEvent event, const ime::PropertyContainer &args) override;
+        void handleEvent(Ghost& ghost, GameEvent event);
 
         /**
          * @brief Exit a state
+         * @param ghost The ghost whose behavior is defined by the state
          *
          * This function will be called by the FSM before the state is
          * destroyed
          */
-        void onExit() override;
+        void onExit(Ghost& ghost);
 
     private:
         /**
          * @brief Defines the chase strategy for each ghost
+         * @param ghost The ghost chasing pacman
          */
-        void chasePacman();
+        void chasePacman(Ghost& ghost);
 
     private:
         int adjMoveHandlerID_;
@@ -27,62 +27,64 @@
 #include "ScatterState.h"
 #include "FrightenedState.h"
 #include "GameObjects/Ghost.h"
+#include "PathFinders/GhostGridMover.h"
 #include "Common/Constants.h"
 #include "Utils/Utils.h"
-#include <cassert>
 
 namespace spm {
     ///////////////////////////////////////////////////////////////
-    EatenState::EatenState(Ghost::State nextState) :
+    EatenState::EatenState(NextState nextState) :
         destFoundHandler_{-1},
         nextState_{nextState}
-    {
-        assert((nextState == Ghost::State::Scatter || nextState == Ghost::State::Chase) && "Invalid regeneration transition state");
-    }
+    {}
 
     ///////////////////////////////////////////////////////////////
-    void EatenState::onEntry() {
-        ghost_->ime::GameObject::setState(static_cast<int>(Ghost::State::Eaten));
-        ghost_->getCollisionExcludeList().add("sensors");
-        ghost_->getCollisionExcludeList().add("doors");
-        GhostState::onEntry();
+    void EatenState::onEntry(Ghost& ghost) {
+        ghost.ime::GameObject::setState(static_cast<int>(Ghost::State::Eaten));
+        ghost.getCollisionExcludeList().add("sensors");
+        ghost.getCollisionExcludeList().add("doors");
+        GhostState::onEntry(ghost);
+
+        GhostGridMover& gridMover = getGridMover(ghost);
+        ghost.getSprite().getAnimator().startAnimation("going" + utils::convertToString(ghost.getDirection()) + "Eaten");
+        gridMover.setTargetTile(Constants::EatenGhostRespawnTile);
+        gridMover.startMovement();
 
-        ghost_->getSprite().getAnimator().startAnimation("going" + utils::convertToString(ghost_->getDirection()) + "Eaten");
-        gridMover_->setTargetTile(Constants::EatenGhostRespawnTile);
-        gridMover_->startMovement();
+        destFoundHandler_ = gridMover.onMoveEnd([this, &ghost](ime::Index index) {
+            if (index != Constants::EatenGhostRespawnTile)
+                return;
 
-        destFoundHandler_ = gridMover_->onMoveEnd([this](ime::Index index) {
-            if (index == Constants::EatenGhostRespawnTile) {
-                if (nextState_ == Ghost::State::Chase)
-                    ghost_->setState(std::make_unique<ChaseState>());
-                else if (nextState_ == Ghost::State::Scatter)
-                    ghost_->setState(std::make_unique<ScatterState>());
-                else {
-                    assert(false && "Unknown state transition from eaten state");
-                }
-            }
+            if (nextState_ == NextState::Chase)
+                ghost.setState<ChaseState>();
+            else
+                ghost.setState<ScatterState>();
         });
     }
 
     ///////////////////////////////////////////////////////////////
-    void EatenState::handleEvent(GameEvent event, const ime::PropertyContainer &args) {
-        GhostState::handleEvent(event, args);
+    void EatenState::handleEvent(Ghost& ghost, GameEvent event) {
+        GhostState::handleEvent(ghost, event);
 
+        // Mode changes do not leave the state, the ghost keeps heading home (see spm::GhostTransitionTable)
         if (event == GameEvent::SuperModeEnd)
-            ghost_->setFlattened(false);
-        else if (event == GameEvent::FrightenedModeBegin)
-            ghost_->setState(std::make_unique<FrightenedState>(nextState_));
+            ghost.setFlattened(false);
         else if (event == GameEvent::ScatterModeBegin)
-            nextState_ = Ghost::State::Scatter;
+            nextState_ = NextState::Scatter;
         else if (event == GameEvent::ChaseModeBegin)
-            nextState_ = Ghost::State::Chase;
+            nextState_ = NextState::Chase;
+        else if (event == GameEvent::FrightenedModeBegin) { // The frightened state depends on nextState_, so it has no table row
+            if (nextState_ == NextState::Chase)
+                ghost.setState<FrightenedState<ChaseState>>(); // Destroys this state
+            else
+                ghost.setState<FrightenedState<ScatterState>>(); // Destroys this state
+        }
     }
 
     ///////////////////////////////////////////////////////////////
-    void EatenState::onExit() {
-        ghost_->getCollisionExcludeList().remove("sensors");
-        ghost_->getCollisionExcludeList().remove("doors");
-        gridMover_->removeEventListener(destFoundHandler_);
+    void EatenState::onExit(Ghost& ghost) {
+        ghost.getCollisionExcludeList().remove("sensors");
+        ghost.getCollisionExcludeList().remove("doors");
+        getGridMover(ghost).removeEventListener(destFoundHandler_);
     }
 
 } // namespace pm
@@ -26,7 +26,6 @@
 #define SUPERPACMAN_EATENSTATE_H
 
 #include "GhostState.h"
-#include "GameObjects/Ghost.h"
 
 namespace spm {
     /**
@@ -34,46 +33,56 @@ namespace spm {
      *
      * In this state the ghost retreats to the ghost house to for a magic
      * pill that completely heals it
+     *
+     * @note If the scatter-chase timer expires while the ghost is eaten,
+     * the state only changes the state the ghost regenerates into, the
+     * ghost keeps heading home undisturbed
      */
     class EatenState final : public GhostState {
     public:
+        /**
+         * @brief The state a ghost enters after it regenerates
+         */
+        enum class NextState {
+            Scatter,    //!< spm::ScatterState
+            Chase       //!< spm::ChaseState
+        };
+
         /**
          * @brief Constructor
-         * @param nextState The state the ghost must transition to after it
-         *                  regenerates
-         *
-         * @note @a nextState may change if the the state timer corresponding
-         * to it expires. In this case it will be automatically adjusted to the
-         * appropriate state
+         * @param nextState The state the ghost must transition to after
+         *                  it regenerates
          */
-        explicit EatenState(Ghost::State nextState);
+        explicit EatenState(NextState nextState = NextState::Scatter);
 
         /**
          * @brief Initialize the state
+         * @param ghost The ghost whose behavior is defined by the state
          *
          * This function will be called by the FSM when a state is entered
          * for the first time
          */
-        void onEntry() override;
+        void onEntry(Ghost& ghost);
 
         /**
          * @brief Handle a game event
+         * @param ghost The ghost whose behavior is defined by the state
          * @param event The event to be handled
-         * @param args Arguments associated with the event
          */
-        void handleEvent(GameEvent event, const ime::PropertyContainer &args) override;
+        void handleEvent(Ghost& ghost, GameEvent event);
 
         /**
          * @brief Exit a state
+         * @param ghost The ghost whose behavior is defined by the state
          *
          * This function will be called by the FSM before the state is
          * destroyed
          */
-        void onExit() override;
+        void onExit(Ghost& ghost);
 
     private:
         int destFoundHandler_;   //!< Handler id for a target destination event
-        Ghost::State nextState_; //!< The state to transition to after reaching the regeneration spot
+        NextState nextState_;    //!< The state the ghost transitions to after it regenerates
     };
 }
 
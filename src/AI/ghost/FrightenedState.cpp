@@ -23,51 +23,41 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "FrightenedState.h"
-#include "EatenState.h"
 #include "ScatterState.h"
 #include "ChaseState.h"
-#include "Utils/Utils.h"
-#include <cassert>
-#include <Common/Constants.h>
+#include "GameObjects/Ghost.h"
+#include "PathFinders/GhostGridMover.h"
 
 namespace spm {
     ///////////////////////////////////////////////////////////////
-    FrightenedState::FrightenedState(Ghost::State nextState) :
-        nextState_{nextState}
-    {}
-
-    ///////////////////////////////////////////////////////////////
-    void FrightenedState::onEntry() {
-        ghost_->ime::GameObject::setState(static_cast<int>(Ghost::State::Frightened));
-        ghost_->getCollisionExcludeList().add("sensors");
-        GhostState::onEntry();
-
-        ghost_->getSprite().getAnimator().startAnimation("frightened");
-        gridMover_->setMoveStrategy(GhostGridMover::Strategy::Random);
-        gridMover_->startMovement();
+    template <typename NextState>
+    void FrightenedState<NextState>::onEntry(Ghost& ghost) {
+        ghost.ime::GameObject::setState(static_cast<int>(Ghost::State::Frightened));
+        ghost.getCollisionExcludeList().add("sensors");
+        GhostState::onEntry(ghost);
+
+        ghost.getSprite().getAnimator().startAnimation("frightened");
+        getGridMover(ghost).setMoveStrategy(GhostGridMover::Strategy::Random);
+        getGridMover(ghost).startMovement();
     }
 
     ///////////////////////////////////////////////////////////////
-    void FrightenedState::handleEvent(GameEvent event, const ime::PropertyContainer &args) {
-        GhostState::handleEvent(event, args);
+    template <typename NextState>
+    void FrightenedState<NextState>::handleEvent(Ghost& ghost, GameEvent event) {
+        GhostState::handleEvent(ghost, event);
 
-        if (event == GameEvent::FrightenedModeEnd) {
-            if (nextState_ == Ghost::State::Scatter)
-                ghost_->setState(std::make_unique<ScatterState>());
-            else if (nextState_ == Ghost::State::Chase)
-                ghost_->setState(std::make_unique<ChaseState>());
-            else {
-                assert(false && "Ghost can only transition to scatter or chase state after it was frightened");
-            }
-        } else if (event == GameEvent::FrightenedModeBegin)
-            reverseDirection();
-        else if (event == GameEvent::SuperModeEnd)
-            ghost_->setFlattened(false);
+        // Transitions are defined in spm::GhostTransitionTable
+        if (event == GameEvent::SuperModeEnd)
+            ghost.setFlattened(false);
     }
 
     ///////////////////////////////////////////////////////////////
-    void FrightenedState::onExit() {
-        ghost_->getCollisionExcludeList().remove("sensors");
+    template <typename NextState>
+    void FrightenedState<NextState>::onExit(Ghost& ghost) {
+        ghost.getCollisionExcludeList().remove("sensors");
     }
 
+    template class FrightenedState<ScatterState>;
+    template class FrightenedState<ChaseState>;
+
 } // namespace pm
@@ -26,54 +26,50 @@
 #define SUPERPACMAN_FRIGHTENEDSTATE_H
 
 #include "GhostState.h"
-#include "GameObjects/Ghost.h"
 
 namespace spm {
     /**
      * @brief Defines the state of a ghost when it is frightened
+     * @tparam NextState The state the ghost returns to when frightened
+     *                   mode expires (spm::ScatterState or spm::ChaseState)
      *
      * When in this state, the ghost is vulnerable and can be eaten by pacman.
      * In addition, it changes colour and moves randomly in the grid
      */
+    template <typename NextState>
     class FrightenedState final : public GhostState {
     public:
-        /**
-         * @brief Constructor
-         * @param nextState The state the ghost must transition to when frightened
-         *                  mode expires
-         *
-         * @note @a nextState may change if the the state timer corresponding
-         * to it expires. In this case it will be automatically adjusted to the
-         * appropriate state
-         */
-        FrightenedState(Ghost::State nextState);
-
         /**
          * @brief Initialize the state
+         * @param ghost The ghost whose behavior is defined by the state
          *
          * This function will be called by the FSM when the state is entered
          * for the first time
          */
-        void onEntry() override;
+        void onEntry(Ghost& ghost);
 
         /**
          * @brief Handle a game event
+         * @param ghost The ghost whose behavior is defined by the state
          * @param event The event to be handled
-         * @param args Arguments associated with the event
          */
-        void handleEvent(GameEvent event, const ime::PropertyContainer &args) override;
+        void handleEvent(Ghost& ghost, GameEvent event);
 
         /**
          * @brief Exit a state
+         * @param ghost The ghost whose behavior is defined by the state
          *
          * This function will be called by the FSM before the state is
          * destroyed
          */
-        void onExit() override;
-
-    private:
-        Ghost::State nextState_; //!< The state
+        void onExit(Ghost& ghost);
     };
+
+    class ScatterState;
+    class ChaseState;
+
+    extern template class FrightenedState<ScatterState>;
+    extern template class FrightenedState<ChaseState>;
 }
 
 #endif
@@ -23,57 +23,42 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "GhostState.h"
-#include "Common/Constants.h"
+#include "GameObjects/Ghost.h"
+#include "PathFinders/GhostGridMover.h"
 #include <cassert>
 
 namespace spm {
     ///////////////////////////////////////////////////////////////
-    GhostState::GhostState() :
-        ghost_{nullptr},
-        gridMover_{nullptr}
-    {}
+    void GhostState::onEntry(Ghost& ghost) {
+        assert(ghost.getGridMover() && "Cannot enter state without a ghost grid mover");
 
-    ///////////////////////////////////////////////////////////////
-    void GhostState::setTarget(Ghost *ghost) {
-        assert(ghost && "Ghost must not be a nullptr");
-        assert(ghost->getGridMover() && "Cannot construct a ghost state without a grid mover");
-        ghost_ = ghost;
-        gridMover_ = dynamic_cast<GhostGridMover*>(ghost->getGridMover());
-        assert(gridMover_ && "Invalid ghost grid mover, only candidate is spm::GhostGridMover");
-    }
-
-    ///////////////////////////////////////////////////////////////
-    void GhostState::onEntry() {
-        assert(ghost_->getGridMover() && "Cannot enter state without a ghost grid mover");
-
-        switch (ghost_->getState()) {
-            case Ghost::State::Scatter:     ghost_->getGridMover()->setSpeedMultiplier(1.0f);   break;
-            case Ghost::State::Chase:       ghost_->getGridMover()->setSpeedMultiplier(1.08f);  break;
-            case Ghost::State::Frightened:  ghost_->getGridMover()->setSpeedMultiplier(0.5f);   break;
-            case Ghost::State::Eaten:       ghost_->getGridMover()->setSpeedMultiplier(4.0f);   break;
+        const LevelTuning& tuning = getGridMover(ghost).getLevelTuning();
+        switch (ghost.getState()) {
+            case Ghost::State::Scatter:     ghost.getGridMover()->setSpeedMultiplier(tuning.scatterSpeedMultiplier);     break;
+            case Ghost::State::Chase:       ghost.getGridMover()->setSpeedMultiplier(tuning.chaseSpeedMultiplier);       break;
+            case Ghost::State::Frightened:  ghost.getGridMover()->setSpeedMultiplier(tuning.frightenedSpeedMultiplier);  break;
+            case Ghost::State::Eaten:       ghost.getGridMover()->setSpeedMultiplier(tuning.eatenSpeedMultiplier);       break;
             default: break;
         }
 
-        gridMover_->setMoveStrategy(GhostGridMover::Strategy::Target);
+        getGridMover(ghost).setMoveStrategy(GhostGridMover::Strategy::Target);
     }
 
     ///////////////////////////////////////////////////////////////
-    void GhostState::handleEvent(GameEvent event, const ime::PropertyContainer &args) {
-        switch (ghost_->getState()) {
-            case Ghost::State::Scatter:
-            case Ghost::State::Chase:
-            case Ghost::State::Eaten:
-                if (event == GameEvent::FrightenedModeBegin)
-                    reverseDirection();
-                break;
-            default:
-                break;
-        }
+    void GhostState::handleEvent(Ghost& ghost, GameEvent event) {
+        if (event == GameEvent::FrightenedModeBegin)
+            reverseDirection(ghost);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    GhostGridMover& GhostState::getGridMover(Ghost& ghost) {
+        assert(dynamic_cast<GhostGridMover*>(ghost.getGridMover()) && "Invalid ghost grid mover, only candidate is spm::GhostGridMover");
+        return *static_cast<GhostGridMover*>(ghost.getGridMover());
     }
 
     ///////////////////////////////////////////////////////////////
-    void GhostState::reverseDirection() {
-        gridMover_->reverseDirection();
+    void GhostState::reverseDirection(Ghost& ghost) {
+        getGridMover(ghost).reverseDirection();
     }
 
 } // namespace pm
@@ -25,66 +25,62 @@
 #ifndef SUPERPACMAN_GHOSTSTATE_H
 #define SUPERPACMAN_GHOSTSTATE_H
 
-#include "AI/IActorState.h"
-#include "PathFinders/GhostGridMover.h"
-#include <IME/core/time/Timer.h>
-#include <IME/core/physics/grid/GridMover.h>
+#include "Common/Events.h"
+#include <IME/core/time/Time.h>
 
 namespace spm {
     class Ghost;
     class GhostGridMover;
 
     /**
-     * @brief Intermediate abstract base class for a ghost state
+     * @brief Intermediate base class for a ghost state
      *
      * This class implements functions that are Common to all ghost states.
-     * Its main purpose is to avoid code duplication across states
+     * Its main purpose is to avoid code duplication across states. Ghost
+     * states are stored by value in a spm::GhostStateMachine, therefore a
+     * state hides (rather than overrides) the functions it customizes
      */
-    class GhostState : public IActorState {
+    class GhostState {
     public:
-        /**
-         * @brief Constructor
-         */
-        GhostState();
-
-        /**
-         * @brief @brief Set the target for the state
-         * @param ghost The target ghost
-         */
-        void setTarget(Ghost* ghost);
-
         /**
          * @brief Initialize the state
+         * @param ghost The ghost whose behavior is defined by the state
          */
-        void onEntry() override;
+        void onEntry(Ghost& ghost);
 
         /**
          * @brief Update the state
+         * @param ghost The ghost whose behavior is defined by the state
          * @param deltaTime Time passed since last update
          */
-        void update(ime::Time deltaTime) override {}
+        void update(Ghost& ghost, ime::Time deltaTime) {}
 
         /**
          * @brief Handle an event
+         * @param ghost The ghost whose behavior is defined by the state
          * @param event The event to be handled
-         * @param args Event arguments
          */
-        void handleEvent(GameEvent event, const ime::PropertyContainer &args) override;
+        void handleEvent(Ghost& ghost, GameEvent event);
 
         /**
          * @brief Exit the state
+         * @param ghost The ghost whose behavior is defined by the state
          */
-        void onExit() override {}
+        void onExit(Ghost& ghost) {}
 
     protected:
         /**
-         * @brief Reverse direction
+         * @brief Get the grid mover of a ghost
+         * @param ghost The ghost to get the grid mover of
+         * @return The ghosts grid mover
          */
-        void reverseDirection();
+        static GhostGridMover& getGridMover(Ghost& ghost);
 
-    protected:
-        Ghost* ghost_;              //!< Ghost whose behavior is to be defined by the state (@warning Do not access in constructor)
-        GhostGridMover* gridMover_; //!< Responsible for moving the ghost in the grid (@warning Do not access in constructor)
+        /**
+         * @brief Reverse direction
+         * @param ghost The ghost to reverse
+         */
+        static void reverseDirection(Ghost& ghost);
     };
 }
 
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_GHOSTSTATEMACHINE_H
+#define SUPERPACMAN_GHOSTSTATEMACHINE_H
+
+#include "AI/StateMachine.h"
+#include "ScatterState.h"
+#include "ChaseState.h"
+#include "FrightenedState.h"
+#include "EatenState.h"
+
+namespace spm {
+    class Ghost;
+
+    /**
+     * @brief Defines how a ghost moves between states in response to game events
+     *
+     * Events not listed here are still handled by the current state (for
+     * example spm::GameEvent::SuperModeBegin flattens the ghost), they just
+     * don't change the state. A frightened ghost remembers whether to
+     * resume scattering or chasing through its state type. An eaten ghost
+     * keeps heading home when the mode changes, so it remembers it in a
+     * field instead and leaves spm::EatenState by itself
+     */
+    using GhostTransitionTable = TransitionTable<
+        Transition<ScatterState,                  GameEvent::ChaseModeBegin,      ChaseState>,
+        Transition<ScatterState,                  GameEvent::FrightenedModeBegin, FrightenedState<ScatterState>>,
+        Transition<ChaseState,                    GameEvent::ScatterModeBegin,    ScatterState>,
+        Transition<ChaseState,                    GameEvent::FrightenedModeBegin, FrightenedState<ChaseState>>,
+        Transition<FrightenedState<ScatterState>, GameEvent::FrightenedModeEnd,   ScatterState>,
+        Transition<FrightenedState<ChaseState>,   GameEvent::FrightenedModeEnd,   ChaseState>
+    >;
+
+    /**
+     * @brief Ghost AI
+     */
+    using GhostStateMachine = StateMachine<Ghost, GhostTransitionTable,
+        ScatterState,
+        ChaseState,
+        FrightenedState<ScatterState>,
+        FrightenedState<ChaseState>,
+        EatenState
+    >;
+}
+
+#endif
@@ -23,49 +23,47 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "ScatterState.h"
-#include "ChaseState.h"
-#include "FrightenedState.h"
+#include "GameObjects/Ghost.h"
+#include "PathFinders/GhostGridMover.h"
 #include "Utils/Utils.h"
 #include "Common/Constants.h"
 #include <cassert>
 
 namespace spm {
     ///////////////////////////////////////////////////////////////
-    void ScatterState::onEntry() {
-        ghost_->ime::GameObject::setState(static_cast<int>(Ghost::State::Scatter));
-        GhostState::onEntry();
+    void ScatterState::onEntry(Ghost& ghost) {
+        ghost.ime::GameObject::setState(static_cast<int>(Ghost::State::Scatter));
+        GhostState::onEntry(ghost);
 
-        ghost_->getSprite().getAnimator().startAnimation("going" + utils::convertToString(ghost_->getDirection()) + (ghost_->isFlat() ? "Flat" : ""));
+        ghost.getSprite().getAnimator().startAnimation("going" + utils::convertToString(ghost.getDirection()) + (ghost.isFlat() ? "Flat" : ""));
 
-        if (ghost_->getTag() == "blinky")
-            gridMover_->setTargetTile(Constants::BLINKY_SCATTER_TARGET_TILE);
-        else if (ghost_->getTag() == "pinky")
-            gridMover_->setTargetTile(Constants::PINKY_SCATTER_TARGET_TILE);
-        else if (ghost_->getTag() == "inky")
-            gridMover_->setTargetTile(Constants::INKY_SCATTER_TARGET_TILE);
-        else if (ghost_->getTag() == "clyde")
-            gridMover_->setTargetTile(Constants::CLYDE_SCATTER_TARGET_TILE);
+        GhostGridMover& gridMover = getGridMover(ghost);
+        if (ghost.getTag() == "blinky")
+            gridMover.setTargetTile(Constants::BLINKY_SCATTER_TARGET_TILE);
+        else if (ghost.getTag() == "pinky")
+            gridMover.setTargetTile(Constants::PINKY_SCATTER_TARGET_TILE);
+        else if (ghost.getTag() == "inky")
+            gridMover.setTargetTile(Constants::INKY_SCATTER_TARGET_TILE);
+        else if (ghost.getTag() == "clyde")
+            gridMover.setTargetTile(Constants::CLYDE_SCATTER_TARGET_TILE);
         else {
             assert(false && "Failed to initialize ScatterState, unknown ghost tag");
         }
 
-        gridMover_->startMovement();
+        gridMover.startMovement();
     }
 
     ///////////////////////////////////////////////////////////////
-    void ScatterState::handleEvent(GameEvent event, const ime::PropertyContainer &args) {
-        GhostState::handleEvent(event, args);
+    void ScatterState::handleEvent(Ghost& ghost, GameEvent event) {
+        GhostState::handleEvent(ghost, event);
 
+        // Transitions are defined in spm::GhostTransitionTable
         if (event == GameEvent::SuperModeBegin)
-            ghost_->setFlattened(true);
+            ghost.setFlattened(true);
         else if (event == GameEvent::SuperModeEnd)
-            ghost_->setFlattened(false);
-        else if (event == GameEvent::FrightenedModeBegin)
-            ghost_->setState(std::make_unique<FrightenedState>(Ghost::State::Scatter));
-        else if (event == GameEvent::ChaseModeBegin) {
-            reverseDirection();
-            ghost_->setState(std::make_unique<ChaseState>());
-        }
+            ghost.setFlattened(false);
+        else if (event == GameEvent::ChaseModeBegin)
+            reverseDirection(ghost);
     }
 
 } // namespace pm
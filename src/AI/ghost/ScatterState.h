@@ -43,18 +43,19 @@ namespace spm {
     public:
         /**
          * @brief Initialize the state
+         * @param ghost The ghost whose behavior is defined by the state
          *
          * This function will be called by the FSM before a state is entered
          * for the first time
          */
-        void onEntry() override;
+        void onEntry(Ghost& ghost);
 
         /**
          * @brief Handle a game event
+         * @param ghost The ghost whose behavior is defined by the state
          * @param event The event to be handled
-         * @param args Arguments associated with the event
          */
-        void handleEvent(GameEvent event, const ime::PropertyContainer &args) override;
+        void handleEvent(Ghost& ghost, GameEvent event);
     };
 }
 
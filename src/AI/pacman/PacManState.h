@@ -1,5 +1,5 @@
 ////////////////////////////////////////////////////////////////////////////////
-// Pac-Man clone
+// Super Pac-Man clone
 //
 // Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
 //
@@ -22,53 +22,50 @@
 // SOFTWARE.
 ////////////////////////////////////////////////////////////////////////////////
 
-#ifndef SUPERPACMAN_IACTORSTATE_H
-#define SUPERPACMAN_IACTORSTATE_H
+#ifndef SUPERPACMAN_PACMANSTATE_H
+#define SUPERPACMAN_PACMANSTATE_H
 
 #include "Common/Events.h"
 #include <IME/core/time/Time.h>
-#include <IME/common/PropertyContainer.h>
-#include <memory>
 
 namespace spm {
+    class PacMan;
+
     /**
-     * @brief Interface for actor states
+     * @brief Intermediate base class for a pacman state
+     *
+     * This class implements functions that are common to all pacman states.
+     * Pacman states are stored by value in a spm::PacManStateMachine,
+     * therefore a state hides (rather than overrides) the functions it
+     * customizes
      */
-    class IActorState {
+    class PacManState {
     public:
-        using Ptr = std::unique_ptr<IActorState>;
-
         /**
          * @brief Initialize the state
-         *
-         * This function is called when the state is entered
-         */
-        virtual void onEntry() = 0;
-
-        /**
-         * @brief Exit a state
-         *
-         * This function is called when the state is exited
+         * @param pacman The pacman whose behavior is defined by the state
          */
-        virtual void onExit() = 0;
+        void onEntry(PacMan& pacman);
 
         /**
-         * @brief update the state
-         * @param deltaTime Time passed since last state update
+         * @brief Update the state
+         * @param pacman The pacman whose behavior is defined by the state
+         * @param deltaTime Time passed since last update
          */
-        virtual void update(ime::Time deltaTime) = 0;
+        void update(PacMan& pacman, ime::Time deltaTime) {}
 
         /**
-         * @brief Handle a game event
+         * @brief Handle an event
+         * @param pacman The pacman whose behavior is defined by the state
          * @param event The event to be handled
-         * @param args Arguments associated with the event
          */
-        virtual void handleEvent(GameEvent event, const ime::PropertyContainer& args) = 0;
+        void handleEvent(PacMan& pacman, GameEvent event) {}
 
         /**
-         * @brief Destructor
+         * @brief Exit the state
+         * @param pacman The pacman whose behavior is defined by the state
          */
-        virtual ~IActorState() = default;
+        void onExit(PacMan& pacman) {}
     };
 }
 
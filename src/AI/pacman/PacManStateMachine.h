@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_PACMANSTATEMACHINE_H
+#define SUPERPACMAN_PACMANSTATEMACHINE_H
+
+#include "AI/StateMachine.h"
+#include "NormalState.h"
+#include "SuperState.h"
+#include "DyingState.h"
+
+namespace spm {
+    class PacMan;
+
+    /**
+     * @brief Defines how pacman moves between states in response to game events
+     *
+     * spm::DyingState has no outgoing transitions, pacman only leaves it
+     * when the level is reset
+     */
+    using PacManTransitionTable = TransitionTable<
+        Transition<NormalState, GameEvent::SuperModeBegin, SuperState>,
+        Transition<SuperState,  GameEvent::SuperModeEnd,   NormalState>
+    >;
+
+    /**
+     * @brief Pacman state machine
+     */
+    using PacManStateMachine = StateMachine<PacMan, PacManTransitionTable,
+        NormalState,
+        SuperState,
+        DyingState
+    >;
+}
+
+#endif
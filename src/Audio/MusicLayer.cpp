@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "MusicLayer.h"
+#include <IME/core/audio/Sfx.h>
+#include <algorithm>
+#include <cassert>
+
+namespace spm {
+    namespace {
+        constexpr std::array<const char*, static_cast<std::size_t>(MusicTrack::Count)> filenames = {
+            "wieu_wieu_slow.ogg",   // Siren
+            "ghostsTurnedBlue.wav"  // Frightened
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////
+    MusicLayer::MusicLayer() :
+        gains_{},
+        current_{MusicTrack::Siren},
+        volume_{100.0f},
+        isMuted_{false},
+        isFading_{false}
+    {
+        for (std::size_t i = 0; i < tracks_.size(); ++i) {
+            tracks_[i] = std::make_unique<ime::audio::Sfx>();
+            tracks_[i]->setSource(filenames[i]);
+            tracks_[i]->setLoop(true);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    MusicLayer::~MusicLayer() = default;
+
+    ///////////////////////////////////////////////////////////////
+    void MusicLayer::play(MusicTrack track) {
+        assert(track != MusicTrack::Count && "Invalid music track");
+        stop();
+        current_ = track;
+        gains_[static_cast<std::size_t>(track)] = 1.0f;
+        applyVolume();
+        tracks_[static_cast<std::size_t>(track)]->play();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void MusicLayer::switchTo(MusicTrack track) {
+        assert(track != MusicTrack::Count && "Invalid music track");
+        auto& sound = tracks_[static_cast<std::size_t>(track)];
+        if (track == current_ && sound->getStatus() != ime::audio::Status::Stopped)
+            return;
+
+        // A track that is still fading out is faded back in where it is
+        if (sound->getStatus() == ime::audio::Status::Stopped) {
+            gains_[static_cast<std::size_t>(track)] = 0.0f;
+            applyVolume();
+            sound->play();
+        }
+
+        current_ = track;
+        isFading_ = true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void MusicLayer::pause() {
+        for (auto& track : tracks_) {
+            if (track->getStatus() == ime::audio::Status::Playing)
+                track->pause();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void MusicLayer::resume() {
+        for (auto& track : tracks_) {
+            if (track->getStatus() == ime::audio::Status::Paused)
+                track->play();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void MusicLayer::stop() {
+        for (auto& track : tracks_)
+            track->stop();
+
+        gains_.fill(0.0f);
+        isFading_ = false;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void MusicLayer::setVolume(float volume) {
+        volume_ = volume;
+        applyVolume();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void MusicLayer::setMute(bool mute) {
+        isMuted_ = mute;
+        applyVolume();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void MusicLayer::update(ime::Time deltaTime) {
+        if (!isFading_)
+            return;
+
+        // Paused tracks keep their gain until they are resumed
+        if (tracks_[static_cast<std::size_t>(current_)]->getStatus() == ime::audio::Status::Paused)
+            return;
+
+        float step = deltaTime.asSeconds() / CrossfadeDuration;
+        isFading_ = false;
+
+        for (std::size_t i = 0; i < tracks_.size(); ++i) {
+            if (i == static_cast<std::size_t>(current_)) {
+                gains_[i] = std::min(gains_[i] + step, 1.0f);
+                isFading_ = isFading_ || gains_[i] < 1.0f;
+            } else if (gains_[i] > 0.0f) {
+                gains_[i] = std::max(gains_[i] - step, 0.0f);
+
+                if (gains_[i] == 0.0f)
+                    tracks_[i]->stop();
+                else
+                    isFading_ = true;
+            }
+        }
+
+        applyVolume();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void MusicLayer::applyVolume() {
+        for (std::size_t i = 0; i < tracks_.size(); ++i)
+            tracks_[i]->setVolume(isMuted_ ? 0.0f : volume_ * gains_[i]);
+    }
+
+} // namespace spm
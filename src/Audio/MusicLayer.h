@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_MUSICLAYER_H
+#define SUPERPACMAN_MUSICLAYER_H
+
+#include <IME/core/time/Time.h>
+#include <array>
+#include <memory>
+
+namespace ime::audio {
+    class Sfx;
+}
+
+namespace spm {
+    /**
+     * @brief The background loops played during gameplay
+     */
+    enum class MusicTrack {
+        Siren,      //!< Played while the ghosts scatter or chase
+        Frightened, //!< Played while the ghosts are frightened
+        Count       //!< The number of tracks, keep last
+    };
+
+    /**
+     * @brief Plays the gameplay loops and crossfades between them
+     *
+     * Every track is bound to its decoded buffer on construction, so a
+     * switch only starts a sound that already exists instead of opening
+     * and decoding the file again. The new track fades in while the old
+     * one fades out, there is no silence between the two loops
+     */
+    class MusicLayer {
+    public:
+        static constexpr float CrossfadeDuration = 0.12f; //!< Duration of a crossfade in seconds
+
+        /**
+         * @brief Constructor
+         *
+         * The buffers of the tracks must already be loaded by the resource
+         * manager, otherwise they are loaded from disk here
+         */
+        MusicLayer();
+
+        /**
+         * @brief Copy constructor
+         */
+        MusicLayer(const MusicLayer&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        MusicLayer& operator=(const MusicLayer&) = delete;
+
+        /**
+         * @brief Destructor
+         */
+        ~MusicLayer();
+
+        /**
+         * @brief Play a track from the beginning without a crossfade
+         * @param track The track to be played
+         *
+         * All other tracks are stopped
+         */
+        void play(MusicTrack track);
+
+        /**
+         * @brief Crossfade to a track
+         * @param track The track to switch to
+         *
+         * The track is started from the beginning if it is not already
+         * audible. This function does nothing if @a track is the current
+         * track
+         *
+         * @see update
+         */
+        void switchTo(MusicTrack track);
+
+        /**
+         * @brief Pause the playing tracks
+         */
+        void pause();
+
+        /**
+         * @brief Resume the paused tracks
+         */
+        void resume();
+
+        /**
+         * @brief Stop all tracks
+         */
+        void stop();
+
+        /**
+         * @brief Set the volume of the music
+         * @param volume The new volume in the range [0, 100]
+         */
+        void setVolume(float volume);
+
+        /**
+         * @brief Mute or unmute the music
+         * @param mute True to mute, otherwise false
+         */
+        void setMute(bool mute);
+
+        /**
+         * @brief Advance a crossfade in progress
+         * @param deltaTime Time passed since the last update
+         *
+         * This function must be called once per frame
+         */
+        void update(ime::Time deltaTime);
+
+    private:
+        /**
+         * @brief Apply the gain of each track and the music volume to the tracks
+         */
+        void applyVolume();
+
+    private:
+        std::array<std::unique_ptr<ime::audio::Sfx>, static_cast<std::size_t>(MusicTrack::Count)> tracks_; //!< Looping sounds of the tracks
+        std::array<float, static_cast<std::size_t>(MusicTrack::Count)> gains_; //!< Fade level of each track in the range [0, 1]
+        MusicTrack current_;   //!< The track being faded in or played
+        float volume_;         //!< The volume of the music
+        bool isMuted_;         //!< A flag indicating whether or not the music is muted
+        bool isFading_;        //!< A flag indicating whether or not a crossfade is in progress
+    };
+}
+
+#endif
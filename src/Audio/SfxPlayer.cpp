@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "SfxPlayer.h"
+#include <IME/core/audio/Sfx.h>
+#include <cassert>
+
+namespace spm {
+    namespace {
+        /**
+         * @brief How an effect is played
+         */
+        struct EffectInfo {
+            SoundEffect effect;     //!< The effect
+            const char* filename;   //!< The filename of the buffer of the effect
+            int priority;           //!< Effects with a higher priority steal voices of effects with a lower one
+            std::size_t maxVoices;  //!< The maximum number of playbacks of the effect at the same time
+        };
+
+        constexpr std::array<EffectInfo, static_cast<std::size_t>(SoundEffect::Count)> effects = {{
+            {SoundEffect::FruitEaten,         "WakkaWakka.wav",         0, 2},
+            {SoundEffect::KeyEaten,           "keyEaten.wav",           1, 1},
+            {SoundEffect::PowerPelletEaten,   "powerPelletEaten.wav",   1, 1},
+            {SoundEffect::SuperPelletEaten,   "superPelletEaten.wav",   1, 1},
+            {SoundEffect::GhostEaten,         "ghostEaten.wav",         2, 2},
+            {SoundEffect::PacManDying,        "pacmanDying.wav",        3, 1},
+            {SoundEffect::BonusFruitMatch,    "bonusFruitMatch.wav",    2, 1},
+            {SoundEffect::BonusFruitNotMatch, "bonusFruitNotMatch.wav", 2, 1},
+            {SoundEffect::DoorBroken,         "doorBroken.wav",         1, 2},
+            {SoundEffect::ExtraLife,          "extraLife.wav",          2, 1},
+            {SoundEffect::LevelComplete,      "levelComplete.ogg",      3, 1},
+            {SoundEffect::StarSpawned,        "starSpawned.wav",        1, 1}
+        }};
+
+        constexpr bool isIndexedByEffect() {
+            for (std::size_t i = 0; i < effects.size(); ++i) {
+                if (static_cast<std::size_t>(effects[i].effect) != i || effects[i].maxVoices == 0)
+                    return false;
+            }
+
+            return true;
+        }
+
+        static_assert(isIndexedByEffect(), "Every effect needs one entry with at least one voice, in enum order");
+    }
+
+    ///////////////////////////////////////////////////////////////
+    SfxPlayer::SfxPlayer() :
+        firstVoice_{},
+        lastId_{InvalidVoice},
+        volume_{100.0f},
+        isMuted_{false}
+    {
+        for (const auto& info : effects) {
+            firstVoice_[static_cast<std::size_t>(info.effect)] = voices_.size();
+
+            for (std::size_t i = 0; i < info.maxVoices; ++i) {
+                auto sound = std::make_unique<ime::audio::Sfx>();
+                sound->setSource(info.filename);
+                voices_.push_back(Voice{std::move(sound), info.effect, info.priority, InvalidVoice});
+            }
+        }
+
+        firstVoice_.back() = voices_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    SfxPlayer::~SfxPlayer() = default;
+
+    ///////////////////////////////////////////////////////////////
+    SfxPlayer::VoiceId SfxPlayer::play(SoundEffect effect, bool loop) {
+        Voice* voice = acquireVoice(effect);
+        if (!voice)
+            return InvalidVoice;
+
+        voice->id = ++lastId_;
+        voice->sound->stop();
+        voice->sound->setLoop(loop);
+        voice->sound->play();
+        return voice->id;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void SfxPlayer::stop(VoiceId voice) {
+        if (voice == InvalidVoice)
+            return;
+
+        for (auto& v : voices_) {
+            if (v.id == voice) {
+                v.sound->stop();
+                return;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void SfxPlayer::pauseAll() {
+        for (auto& voice : voices_) {
+            if (voice.sound->getStatus() == ime::audio::Status::Playing)
+                voice.sound->pause();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void SfxPlayer::resumeAll() {
+        for (auto& voice : voices_) {
+            if (voice.sound->getStatus() == ime::audio::Status::Paused)
+                voice.sound->play();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void SfxPlayer::stopAll() {
+        for (auto& voice : voices_)
+            voice.sound->stop();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void SfxPlayer::setVolume(float volume) {
+        volume_ = volume;
+
+        if (!isMuted_) {
+            for (auto& voice : voices_)
+                voice.sound->setVolume(volume_);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void SfxPlayer::setMute(bool mute) {
+        isMuted_ = mute;
+
+        for (auto& voice : voices_)
+            voice.sound->setVolume(isMuted_ ? 0.0f : volume_);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool SfxPlayer::isBusy(const Voice& voice) {
+        return voice.sound->getStatus() != ime::audio::Status::Stopped;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    SfxPlayer::Voice* SfxPlayer::acquireVoice(SoundEffect effect) {
+        auto index = static_cast<std::size_t>(effect);
+        assert(index < effects.size() && "Invalid sound effect");
+
+        // Restart the oldest voice of the effect when all of them are busy,
+        // the number of audible voices stays the same
+        Voice* freeVoice = nullptr;
+        Voice* oldestOwnVoice = nullptr;
+        for (std::size_t i = firstVoice_[index]; i < firstVoice_[index + 1]; ++i) {
+            Voice& voice = voices_[i];
+            if (!isBusy(voice)) {
+                freeVoice = &voice;
+                break;
+            }
+
+            if (!oldestOwnVoice || voice.id < oldestOwnVoice->id)
+                oldestOwnVoice = &voice;
+        }
+
+        if (!freeVoice)
+            return oldestOwnVoice;
+
+        std::size_t numBusyVoices = 0;
+        Voice* victim = nullptr;
+        for (auto& voice : voices_) {
+            if (isBusy(voice)) {
+                numBusyVoices++;
+
+                if (voice.priority <= effects[index].priority && (!victim || voice.id < victim->id))
+                    victim = &voice;
+            }
+        }
+
+        if (numBusyVoices < VoiceCount)
+            return freeVoice;
+        else if (!victim)
+            return nullptr;
+
+        victim->sound->stop();
+        return freeVoice;
+    }
+
+} // namespace spm
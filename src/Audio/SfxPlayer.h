@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_SFXPLAYER_H
+#define SUPERPACMAN_SFXPLAYER_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ime::audio {
+    class Sfx;
+}
+
+namespace spm {
+    /**
+     * @brief The sound effects played during gameplay
+     */
+    enum class SoundEffect {
+        FruitEaten,         //!< Pacman ate a fruit
+        KeyEaten,           //!< Pacman collected a key
+        PowerPelletEaten,   //!< Pacman ate a power pellet
+        SuperPelletEaten,   //!< Pacman ate a super pellet
+        GhostEaten,         //!< Pacman ate a frightened ghost
+        PacManDying,        //!< Pacman was caught
+        BonusFruitMatch,    //!< The bonus fruits matched when pacman ate the star
+        BonusFruitNotMatch, //!< The bonus fruits did not match when pacman ate the star
+        DoorBroken,         //!< Super pacman broke a door
+        ExtraLife,          //!< The player won an extra life
+        LevelComplete,      //!< The level was cleared
+        StarSpawned,        //!< The star appeared in the maze
+        Count               //!< The number of sound effects, keep last
+    };
+
+    /**
+     * @brief Plays sound effects through a fixed pool of voices
+     *
+     * Every effect gets as many voices as it may play at the same time
+     * and each voice is bound to the buffer of its effect on construction,
+     * so playing an effect only restarts a voice that already exists. At
+     * most VoiceCount voices are audible at once. When the pool is full,
+     * the oldest voice of an effect with the same or a lower priority is
+     * stolen, otherwise the new effect is dropped. When all the voices of
+     * an effect are busy, its own oldest voice is restarted
+     */
+    class SfxPlayer {
+    public:
+        static constexpr std::size_t VoiceCount = 6;  //!< The maximum number of effects audible at once
+
+        using VoiceId = std::uint64_t;                //!< Identifies a single playback of an effect
+        static constexpr VoiceId InvalidVoice = 0;    //!< Returned when an effect could not be played
+
+        /**
+         * @brief Constructor
+         *
+         * The buffers of all the effects must already be loaded by the
+         * resource manager, otherwise they are loaded from disk here
+         */
+        SfxPlayer();
+
+        /**
+         * @brief Copy constructor
+         */
+        SfxPlayer(const SfxPlayer&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        SfxPlayer& operator=(const SfxPlayer&) = delete;
+
+        /**
+         * @brief Destructor
+         */
+        ~SfxPlayer();
+
+        /**
+         * @brief Play a sound effect
+         * @param effect The effect to be played
+         * @param loop True to loop the effect until it is stopped, otherwise false
+         * @return The id of the playback or InvalidVoice if the effect was dropped
+         *
+         * This function does not allocate or access the file system
+         */
+        VoiceId play(SoundEffect effect, bool loop = false);
+
+        /**
+         * @brief Stop a playback
+         * @param voice The id of the playback to be stopped
+         *
+         * This function does nothing if the playback already finished
+         * or its voice was stolen by another effect
+         */
+        void stop(VoiceId voice);
+
+        /**
+         * @brief Pause all playing effects
+         */
+        void pauseAll();
+
+        /**
+         * @brief Resume all paused effects
+         */
+        void resumeAll();
+
+        /**
+         * @brief Stop all effects
+         */
+        void stopAll();
+
+        /**
+         * @brief Set the volume of all effects
+         * @param volume The new volume in the range [0, 100]
+         */
+        void setVolume(float volume);
+
+        /**
+         * @brief Mute or unmute all effects
+         * @param mute True to mute, otherwise false
+         */
+        void setMute(bool mute);
+
+    private:
+        /**
+         * @brief A sound that plays a single effect
+         */
+        struct Voice {
+            std::unique_ptr<ime::audio::Sfx> sound; //!< Sound bound to the buffer of the effect
+            SoundEffect effect;                     //!< The effect played by the voice
+            int priority;                           //!< The priority of the effect
+            VoiceId id;                             //!< The id of the last playback of the voice
+        };
+
+        /**
+         * @brief Check whether or not a voice is playing or paused
+         * @param voice The voice to be checked
+         * @return True if the voice is busy, otherwise false
+         */
+        static bool isBusy(const Voice& voice);
+
+        /**
+         * @brief Find the voice an effect should be played on
+         * @param effect The effect to be played
+         * @return The voice or nullptr if the effect must be dropped
+         */
+        Voice* acquireVoice(SoundEffect effect);
+
+    private:
+        std::vector<Voice> voices_;   //!< All voices, grouped by effect
+        std::array<std::size_t, static_cast<std::size_t>(SoundEffect::Count) + 1> firstVoice_; //!< Index of the first voice of each effect
+        VoiceId lastId_;              //!< The id of the most recent playback
+        float volume_;                //!< The volume of all effects
+        bool isMuted_;                //!< A flag indicating whether or not the effects are muted
+    };
+}
+
+#endif
@@ -0,0 +1,327 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "Autopilot.h"
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace spm {
+    namespace {
+        const std::size_t MAX_NODES = 1 << 17;     // Maximum size of a workers tree
+        const int MAX_TREE_MOVE_STEPS = 20;        // Maximum number of steps a tree move may take
+        const int ROLLOUT_STEPS = 40;              // Number of steps a rollout plays beyond the tree
+        const int DEATH_PENALTY = 5000;            // Points a lost life is worth
+        const int LEVEL_BONUS = 5000;              // Points a cleared level is worth
+        const double VALUE_SCALE = 1.0 / 1000.0;   // Brings values to the scale of the exploration term
+        const double EXPLORATION = 1.4;            // UCB1 exploration constant
+
+        Direction getReverse(Direction direction) {
+            switch (direction) {
+                case Direction::Up: return Direction::Down;
+                case Direction::Left: return Direction::Right;
+                case Direction::Down: return Direction::Up;
+                case Direction::Right: return Direction::Left;
+                default: return Direction::None;
+            }
+        }
+
+        std::uint8_t toBit(Direction direction) {
+            return static_cast<std::uint8_t>(1u << static_cast<int>(direction));
+        }
+
+        int countBits(std::uint8_t bits) {
+            int count = 0;
+            for (; bits != 0; bits &= bits - 1)
+                count++;
+
+            return count;
+        }
+
+        Direction getFirstDirection(std::uint8_t bits) {
+            for (int direction = 1; direction <= 4; direction++) {
+                if (bits & (1u << direction))
+                    return static_cast<Direction>(direction);
+            }
+
+            return Direction::None;
+        }
+
+        int getValue(const GameState& state, const GameState& root) {
+            return (state.score - root.score)
+                + (state.lives - root.lives) * DEATH_PENALTY
+                + (state.level - root.level) * LEVEL_BONUS;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    Autopilot::Autopilot(std::shared_ptr<const MazeLayout> layout, unsigned int numThreads, const GameParameters& parameters) :
+        layout_{std::move(layout)},
+        threadPool_{numThreads},
+        sessionEnvironment_{layout_, parameters},
+        numSearches_{0}
+    {
+        workers_.reserve(threadPool_.getThreadCount());
+        for (unsigned int i = 0; i < threadPool_.getThreadCount(); i++)
+            workers_.push_back(Worker{Environment(layout_, parameters), Random(), {}, {}, 0, 0});
+    }
+
+    ///////////////////////////////////////////////////////////////
+    Action Autopilot::chooseAction(const GameState& state, std::chrono::microseconds budget) {
+        for (auto& worker : workers_) {
+            worker.numRollouts = 0;
+            worker.numSteps = 0;
+        }
+
+        if (state.isGameOver)
+            return Direction::None;
+
+        workers_.front().environment.setState(state);
+        std::uint8_t actions = getActions(workers_.front().environment);
+        if (countBits(actions) <= 1)
+            return getFirstDirection(actions);
+
+        auto deadline = std::chrono::steady_clock::now() + budget;
+        std::uint64_t seed = numSearches_++ * workers_.size();
+
+        threadPool_.run([&](unsigned int index) {
+            workers_[index].random.seed(seed + index);
+            search(workers_[index], state, deadline);
+        });
+
+        // Merge the roots of the trees
+        std::uint64_t visits[5] = {};
+        double values[5] = {};
+        for (const auto& worker : workers_) {
+            const Node& root = worker.nodes.front();
+            for (int direction = 1; direction <= 4; direction++) {
+                if (root.children[direction] >= 0) {
+                    visits[direction] += worker.nodes[root.children[direction]].visits;
+                    values[direction] += worker.nodes[root.children[direction]].value;
+                }
+            }
+        }
+
+        // Keep going if the search did not get anywhere
+        Action bestAction = (actions & toBit(state.pacman.direction)) ? state.pacman.direction : getFirstDirection(actions);
+        std::uint64_t bestVisits = 0;
+        double bestValue = std::numeric_limits<double>::lowest();
+        for (int direction = 1; direction <= 4; direction++) {
+            if (visits[direction] == 0)
+                continue;
+
+            double value = values[direction] / static_cast<double>(visits[direction]);
+            if (visits[direction] > bestVisits || (visits[direction] == bestVisits && value > bestValue)) {
+                bestAction = static_cast<Direction>(direction);
+                bestVisits = visits[direction];
+                bestValue = value;
+            }
+        }
+
+        return bestAction;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    Action Autopilot::chooseAction(const SessionState& session, std::chrono::microseconds budget) {
+        sessionEnvironment_.setState(session);
+        return chooseAction(sessionEnvironment_.getState(), budget);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::future<Action> Autopilot::chooseNextAction(const SessionState& session, std::chrono::microseconds budget) {
+        // The session is copied, the caller may capture the next state while the search runs
+        return std::async(std::launch::async, [this, session, budget] {
+            sessionEnvironment_.setState(session);
+
+            Direction direction = sessionEnvironment_.getState().pacman.direction;
+            if (direction != Direction::None && !sessionEnvironment_.isPacManBlocked(direction))
+                sessionEnvironment_.step(direction);
+
+            return chooseAction(sessionEnvironment_.getState(), budget);
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint64_t Autopilot::getRolloutCount() const {
+        std::uint64_t count = 0;
+        for (const auto& worker : workers_)
+            count += worker.numRollouts;
+
+        return count;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint64_t Autopilot::getStepCount() const {
+        std::uint64_t count = 0;
+        for (const auto& worker : workers_)
+            count += worker.numSteps;
+
+        return count;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    unsigned int Autopilot::getThreadCount() const {
+        return threadPool_.getThreadCount();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Autopilot::search(Worker& worker, const GameState& root, std::chrono::steady_clock::time_point deadline) {
+        std::vector<Node>& nodes = worker.nodes;
+        nodes.clear();
+        nodes.emplace_back();
+        nodes.front().actions = getActions(worker.environment);
+
+        while (std::chrono::steady_clock::now() < deadline) {
+            worker.environment.setState(root);
+            worker.path.assign(1, 0);
+
+            // Selection and expansion
+            std::int32_t nodeIndex = 0;
+            bool isTerminal = false;
+            while (!isTerminal) {
+                const Node& node = nodes[nodeIndex];
+                Direction action = Direction::None;
+                double bestScore = std::numeric_limits<double>::lowest();
+                int offset = worker.random.nextInt(0, 3);
+
+                for (int i = 0; i < 4; i++) {
+                    auto direction = static_cast<Direction>((i + offset) % 4 + 1);
+                    if (!(node.actions & toBit(direction)))
+                        continue;
+
+                    std::int32_t child = node.children[static_cast<int>(direction)];
+                    if (child < 0) {
+                        action = direction;
+                        break;
+                    }
+
+                    const Node& childNode = nodes[child];
+                    double score = childNode.value / childNode.visits * VALUE_SCALE
+                        + EXPLORATION * std::sqrt(std::log(static_cast<double>(node.visits)) / childNode.visits);
+
+                    if (score > bestScore) {
+                        action = direction;
+                        bestScore = score;
+                    }
+                }
+
+                if (action == Direction::None)
+                    break;
+
+                isTerminal = advance(worker, action);
+
+                std::int32_t child = nodes[nodeIndex].children[static_cast<int>(action)];
+                if (child < 0) {
+                    if (nodes.size() < MAX_NODES) {
+                        child = static_cast<std::int32_t>(nodes.size());
+                        nodes[nodeIndex].children[static_cast<int>(action)] = child;
+                        nodes.emplace_back();
+                        nodes.back().actions = getActions(worker.environment);
+                        worker.path.push_back(child);
+                    }
+
+                    break;
+                }
+
+                nodeIndex = child;
+                worker.path.push_back(child);
+            }
+
+            if (!isTerminal)
+                rollout(worker);
+
+            // Backpropagation
+            double value = getValue(worker.environment.getState(), root);
+            for (std::int32_t index : worker.path) {
+                nodes[index].visits++;
+                nodes[index].value += value;
+            }
+
+            worker.numRollouts++;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Autopilot::advance(Worker& worker, Action action) {
+        for (int i = 0; i < MAX_TREE_MOVE_STEPS; i++) {
+            if (step(worker, action))
+                return true;
+
+            // Follow corners, stop at junctions and dead ends
+            const GameState& state = worker.environment.getState();
+            std::uint8_t exits = getActions(worker.environment) & ~toBit(getReverse(state.pacman.direction));
+            if (countBits(exits) != 1)
+                return false;
+
+            action = getFirstDirection(exits);
+        }
+
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Autopilot::rollout(Worker& worker) {
+        for (int i = 0; i < ROLLOUT_STEPS; i++) {
+            const GameState& state = worker.environment.getState();
+            std::uint8_t exits = getActions(worker.environment) & ~toBit(getReverse(state.pacman.direction));
+
+            Action action = Direction::None;
+            if (exits == 0)
+                action = getReverse(state.pacman.direction);
+            else if (countBits(exits) == 1)
+                action = getFirstDirection(exits);
+            else {
+                for (int choice = worker.random.nextInt(1, countBits(exits)); choice > 1; choice--)
+                    exits &= exits - 1;
+
+                action = getFirstDirection(exits);
+            }
+
+            if (step(worker, action))
+                return;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Autopilot::step(Worker& worker, Action action) {
+        const GameState& state = worker.environment.getState();
+        int lives = state.lives;
+        int level = state.level;
+
+        worker.numSteps++;
+        Environment::StepResult result = worker.environment.step(action);
+        return result.done || result.observation.lives < lives || result.observation.level != level;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint8_t Autopilot::getActions(const Environment& environment) {
+        std::uint8_t actions = 0;
+        for (int direction = 1; direction <= 4; direction++) {
+            if (!environment.isPacManBlocked(static_cast<Direction>(direction)))
+                actions |= static_cast<std::uint8_t>(1u << direction);
+        }
+
+        return actions;
+    }
+
+} // namespace spm
@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_AUTOPILOT_H
+#define SUPERPACMAN_AUTOPILOT_H
+
+#include "Environment.h"
+#include "Common/ThreadPool.h"
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Plays pacman by searching ahead with the environment
+     *
+     * Whenever pacman can change direction, the autopilot runs a Monte
+     * Carlo tree search from a copy of the current state. Each thread of
+     * the pool grows its own tree until the time budget runs out, every
+     * iteration playing the game forward with the environment's ghost
+     * logic. The trees are then merged and the most visited direction
+     * is chosen.
+     *
+     * Tree moves run from one junction to the next, beyond the tree the
+     * game is played out by a cheap random policy that never reverses
+     */
+    class Autopilot {
+    public:
+        /**
+         * @brief Constructor
+         * @param layout The maze to play on
+         * @param numThreads The number of threads to search with (0 uses
+         *                   one thread per hardware thread)
+         * @param parameters The gameplay tuning values of the game played
+         */
+        explicit Autopilot(std::shared_ptr<const MazeLayout> layout, unsigned int numThreads = 0,
+            const GameParameters& parameters = GameParameters());
+
+        /**
+         * @brief Choose the direction pacman should take
+         * @param state The current state of the game
+         * @param budget The time the search may take
+         * @return The direction to take or spm::Direction::None if pacman
+         *         cannot move
+         *
+         * The search is skipped when pacman has at most one way to go
+         */
+        Action chooseAction(const GameState& state, std::chrono::microseconds budget);
+
+        /**
+         * @brief Choose the direction pacman should take
+         * @param session A state captured by spm::GameplayScene::captureState
+         * @param budget The time the search may take
+         * @return The direction to take or spm::Direction::None if pacman
+         *         cannot move
+         *
+         * @see spm::Environment::setState
+         */
+        Action chooseAction(const SessionState& session, std::chrono::microseconds budget);
+
+        /**
+         * @brief Choose the direction pacman should take on his next tile
+         * @param session A state captured by spm::GameplayScene::captureState
+         * @param budget The time the search may take
+         * @return The direction to take, available once the search finishes
+         *
+         * The search runs in the background and the calling thread is not
+         * blocked. Pacman is first moved one tile ahead in his direction,
+         * so that the direction is known by the time he gets there. Only
+         * one search may run at a time, the returned future must be ready
+         * before the autopilot is used again
+         */
+        std::future<Action> chooseNextAction(const SessionState& session, std::chrono::microseconds budget);
+
+        /**
+         * @brief Get the number of rollouts played by the last search
+         * @return The number of rollouts played by the last search
+         */
+        std::uint64_t getRolloutCount() const;
+
+        /**
+         * @brief Get the number of environment steps taken by the last search
+         * @return The number of environment steps taken by the last search
+         */
+        std::uint64_t getStepCount() const;
+
+        /**
+         * @brief Get the number of threads the autopilot searches with
+         * @return The number of threads the autopilot searches with
+         */
+        unsigned int getThreadCount() const;
+
+    private:
+        /**
+         * @brief Statistics of a sequence of tree moves
+         */
+        struct Node {
+            std::int32_t children[5] = {-1, -1, -1, -1, -1}; //!< Child node per direction, -1 if not expanded
+            std::uint8_t actions = 0;                         //!< Bit n is set if spm::Direction n can be taken
+            std::uint32_t visits = 0;                         //!< Number of iterations that went through the node
+            double value = 0.0;                               //!< Sum of the values of those iterations
+        };
+
+        /**
+         * @brief The search state of a single thread
+         */
+        struct Worker {
+            Environment environment;       //!< Plays the game forward
+            Random random;                 //!< Drives the rollout policy
+            std::vector<Node> nodes;       //!< The tree, the root is the first node
+            std::vector<std::int32_t> path;//!< Nodes visited by the current iteration
+            std::uint64_t numRollouts;     //!< Rollouts played in the last search
+            std::uint64_t numSteps;        //!< Environment steps taken in the last search
+        };
+
+        /**
+         * @brief Grow the tree of a worker until a deadline
+         * @param worker The worker to search with
+         * @param root The state to search from
+         * @param deadline The time at which to stop
+         */
+        void search(Worker& worker, const GameState& root, std::chrono::steady_clock::time_point deadline);
+
+        /**
+         * @brief Make a tree move
+         * @param worker The worker whose environment to step
+         * @param action The direction to take
+         * @return True if pacman died, the level ended or the game ended
+         *
+         * Pacman follows the maze until the next junction
+         */
+        bool advance(Worker& worker, Action action);
+
+        /**
+         * @brief Play the game of a worker forward with the rollout policy
+         * @param worker The worker whose environment to step
+         */
+        void rollout(Worker& worker);
+
+        /**
+         * @brief Step the environment of a worker
+         * @param worker The worker whose environment to step
+         * @param action The action to take
+         * @return True if pacman died, the level ended or the game ended
+         */
+        bool step(Worker& worker, Action action);
+
+        /**
+         * @brief Get the directions pacman can take in a state
+         * @param environment The environment in the state
+         * @return Bit n is set if spm::Direction n can be taken
+         */
+        static std::uint8_t getActions(const Environment& environment);
+
+    private:
+        std::shared_ptr<const MazeLayout> layout_; //!< The maze to play on
+        ThreadPool threadPool_;                    //!< Runs the workers
+        std::vector<Worker> workers_;              //!< One search state per thread
+        Environment sessionEnvironment_;           //!< Converts session states
+        std::uint64_t numSearches_;                //!< Number of searches run so far, used to seed the workers
+    };
+}
+
+#endif
@@ -0,0 +1,910 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "Environment.h"
+#include "Common/Constants.h"
+#include "GameObjects/DoorKeys.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+
+namespace spm {
+    namespace {
+        const int TILE_SIZE = 20;                // Size of a tile in the gameplay grid, in pixels
+        const int TILE_CREDIT = 100;             // Credit an actor spends to move one tile
+        const int NUM_BONUS_FRUITS = 16;         // Number of frames in the bonus fruit slide animation
+        const int BONUS_FRUIT_FRAME_RATE = 3;    // Frame rate of the bonus fruit slide animation
+        const int LAST_LEVEL = DifficultyTable::LevelCount;
+
+        // Time pacman takes to cross a tile at his normal speed
+        const int STEP_TICKS = static_cast<int>(TILE_SIZE * Constants::SIMULATION_TICK_RATE / Constants::PacManNormalSpeed);
+
+        const auto SpecialTile = ime::Index{13, 13}; // Ghosts cannot move downwards from this tile
+
+        const std::array<Direction, 4> ghostDirections = {Direction::Up, Direction::Left, Direction::Down, Direction::Right};
+
+        ///////////////////////////////////////////////////////////////
+        int toTicks(float seconds) {
+            return static_cast<int>(seconds * Constants::SIMULATION_TICK_RATE);
+        }
+
+        ///////////////////////////////////////////////////////////////
+        ime::Index getAdjacentTile(const ime::Index& index, Direction direction) {
+            switch (direction) {
+                case Direction::Up:     return ime::Index{index.row - 1, index.colm};
+                case Direction::Left:   return ime::Index{index.row, index.colm - 1};
+                case Direction::Down:   return ime::Index{index.row + 1, index.colm};
+                case Direction::Right:  return ime::Index{index.row, index.colm + 1};
+                default:
+                    return index;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////
+        Direction getOpposite(Direction direction) {
+            switch (direction) {
+                case Direction::Up:     return Direction::Down;
+                case Direction::Left:   return Direction::Right;
+                case Direction::Down:   return Direction::Up;
+                case Direction::Right:  return Direction::Left;
+                default:
+                    return Direction::None;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////
+        double getDistance(const ime::Index& lhs, const ime::Index& rhs) {
+            return std::sqrt(std::pow(lhs.row - rhs.row, 2.0) + std::pow(lhs.colm - rhs.colm, 2.0));
+        }
+
+        ///////////////////////////////////////////////////////////////
+        bool isInGhostHouse(const ime::Index& index) {
+            return index.row >= 9 && index.row <= 11 && index.colm >= 11 && index.colm <= 15;
+        }
+
+        ///////////////////////////////////////////////////////////////
+        bool isPacManSuper(const GameState& state) {
+            return state.isBonusStage || state.superTimer > 0;
+        }
+
+        ///////////////////////////////////////////////////////////////
+        ime::Index getSpawnTile(int ghostIndex) {
+            switch (ghostIndex) {
+                case 0:  return Constants::BlinkySpawnTile;
+                case 1:  return Constants::PinkySpawnTile;
+                case 2:  return Constants::InkySpawnTile;
+                default: return Constants::ClydeSpawnTile;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////
+        ime::Index getScatterTarget(int ghostIndex) {
+            switch (ghostIndex) {
+                case 0:  return Constants::BLINKY_SCATTER_TARGET_TILE;
+                case 1:  return Constants::PINKY_SCATTER_TARGET_TILE;
+                case 2:  return Constants::INKY_SCATTER_TARGET_TILE;
+                default: return Constants::CLYDE_SCATTER_TARGET_TILE;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////
+        int toCredit(float speedMultiplier) {
+            return static_cast<int>(std::lround(speedMultiplier * TILE_CREDIT));
+        }
+
+        ///////////////////////////////////////////////////////////////
+        int getPacManSpeed(const GameParameters& parameters, const GameState& state) {
+            return toCredit(parameters.pacmanSpeed / Constants::PacManNormalSpeed * (isPacManSuper(state) ? 4.0f : 1.0f));
+        }
+
+        ///////////////////////////////////////////////////////////////
+        int getGhostSpeed(const LevelTuning& tuning, const GameState::Ghost& ghost) {
+            if (ghost.isInSlowLane)
+                return toCredit(tuning.slowLaneSpeedMultiplier);
+
+            switch (ghost.mode) {
+                case GhostMode::Scatter:    return toCredit(tuning.scatterSpeedMultiplier);
+                case GhostMode::Chase:      return toCredit(tuning.chaseSpeedMultiplier);
+                case GhostMode::Frightened: return toCredit(tuning.frightenedSpeedMultiplier);
+                default:                    return toCredit(tuning.eatenSpeedMultiplier);
+            }
+        }
+    } // namespace anonymous
+
+    ///////////////////////////////////////////////////////////////
+    Environment::Environment(std::shared_ptr<const MazeLayout> layout, const GameParameters& parameters) :
+        layout_{std::move(layout)},
+        parameters_{parameters},
+        state_(),
+        isLevelInterrupted_{false},
+        pacmanDistancesSource_{-1, -1},
+        pacmanDistancesDoors_{0},
+        isPacManDistancesValid_{false}
+    {
+        assert(layout_ && "spm::Environment requires a maze layout");
+        computeDistances(Constants::EatenGhostRespawnTile, false, respawnDistances_);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const GameState& Environment::reset(std::uint64_t seed, int level) {
+        assert(level >= 1 && level <= LAST_LEVEL && "Levels 17 and beyond are unsupported");
+        state_ = GameState();
+        state_.random.seed(seed);
+        state_.lives = Constants::PacManLives;
+        startLevel(level);
+
+        return state_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    Environment::StepResult Environment::step(Action action) {
+        if (state_.isGameOver)
+            return {state_, 0, true};
+
+        int score = state_.score;
+        if (action != Direction::None)
+            state_.pendingDirection = action;
+
+        state_.pacman.credit += getPacManSpeed(parameters_, state_);
+
+        if (!state_.isBonusStage) {
+            const LevelTuning& tuning = getLevelTuning();
+            for (auto& ghost : state_.ghosts)
+                ghost.credit += getGhostSpeed(tuning, ghost);
+        }
+
+        // Each actor moves at most one tile per substep, so faster actors spread their moves over the step
+        int numSubsteps = state_.pacman.credit / TILE_CREDIT;
+        for (const auto& ghost : state_.ghosts)
+            numSubsteps = std::max(numSubsteps, state_.isBonusStage ? 0 : ghost.credit / TILE_CREDIT);
+
+        isLevelInterrupted_ = false;
+        for (int i = 0; i < numSubsteps && !isLevelInterrupted_; i++) {
+            if (state_.pacman.credit >= TILE_CREDIT) {
+                state_.pacman.credit -= TILE_CREDIT;
+                movePacMan();
+            }
+
+            for (int ghost = 0; ghost < 4 && !state_.isBonusStage && !isLevelInterrupted_; ghost++) {
+                if (state_.ghosts[ghost].credit >= TILE_CREDIT) {
+                    state_.ghosts[ghost].credit -= TILE_CREDIT;
+                    moveGhost(ghost);
+                }
+            }
+        }
+
+        if (!isLevelInterrupted_)
+            updateTimers();
+
+        state_.tick += STEP_TICKS;
+        return {state_, state_.score - score, state_.isGameOver};
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const GameState& Environment::getState() const {
+        return state_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::setState(const GameState& state) {
+        state_ = state;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::setState(const SessionState& session) {
+        assert(session.rows == layout_->getRowCount() && session.colms == layout_->getColmCount() && "Session state does not match the maze layout");
+
+        // Rebuild the level, then replace everything that changed since it started
+        state_ = GameState();
+        state_.random.setState(session.randomState);
+        startLevel(session.level);
+
+        state_.score = session.score;
+        state_.lives = session.lives;
+        state_.extraLivesWon = session.extraLivesWon;
+        state_.isBonusStage = session.isBonusStage;
+        state_.pointsMultiplier = session.pointsMultiplier;
+        state_.scatterWave = session.scatterWaveLevel;
+        state_.chaseWave = session.chaseWaveLevel;
+        state_.isChaseMode = session.isChaseMode;
+        state_.hasStarAppeared = session.starAppeared;
+        state_.numItemsEaten = session.numFruitsEaten + session.numPelletsEaten;
+
+        auto toTimer = [](const SessionState::Timer& timer) {
+            return timer.status == SessionState::Timer::Status::Stopped ? 0 : std::max(1, timer.remaining * Constants::SIMULATION_TICK_RATE / 1000);
+        };
+
+        state_.modeTimer = toTimer(session.ghostAITimer);
+        state_.isModeTimerPaused = session.ghostAITimer.status == SessionState::Timer::Status::Paused;
+        state_.frightenedTimer = toTimer(session.powerModeTimer);
+        state_.superTimer = toTimer(session.superModeTimer);
+        state_.bonusStageTimer = toTimer(session.bonusStageTimer);
+        state_.starTimer = toTimer(session.starTimer);
+        state_.starAge = 0;
+        state_.bonusFruitStopFrame = NUM_BONUS_FRUITS - 1;
+
+        state_.numItemsLeft = 0;
+        for (int row = 0; row < layout_->getRowCount(); row++) {
+            for (int colm = 0; colm < layout_->getColmCount(); colm++) {
+                std::size_t bit = row * session.colms + colm;
+                std::uint8_t& item = state_.items[MazeLayout::toCell(ime::Index{row, colm})];
+
+                if (bit / 8 >= session.items.size() || (session.items[bit / 8] & (1u << (bit % 8))) == 0)
+                    item = GameState::NoItem;
+                else if (item != GameState::NoItem && item < GameState::FirstKey)
+                    state_.numItemsLeft++;
+            }
+        }
+
+        state_.lockedDoors = 0;
+        for (std::size_t i = 0; i < session.doors.size(); i++) {
+            if (session.doors[i] == SessionState::DoorStatus::Locked)
+                state_.lockedDoors |= std::uint64_t{1} << (i + 1);
+        }
+
+        auto toActor = [](const SessionState::Actor& actor, GameState::Actor& result) {
+            result.direction = Direction::None;
+            if (actor.dirY < 0)
+                result.direction = Direction::Up;
+            else if (actor.dirX < 0)
+                result.direction = Direction::Left;
+            else if (actor.dirY > 0)
+                result.direction = Direction::Down;
+            else if (actor.dirX > 0)
+                result.direction = Direction::Right;
+
+            // Progress is measured in 1/16 pixels
+            result.tile = ime::Index{actor.row, actor.colm};
+            if (actor.progress >= TILE_SIZE * 16 / 2)
+                result.tile = getAdjacentTile(result.tile, result.direction);
+
+            result.credit = 0;
+        };
+
+        toActor(session.pacman, state_.pacman);
+        if (state_.pacman.direction == Direction::None)
+            state_.pacman.direction = Direction::Left;
+
+        for (std::size_t i = 0; i < state_.ghosts.size(); i++) {
+            const SessionState::Actor& ghostState = session.ghosts[i];
+            GameState::Ghost& ghost = state_.ghosts[i];
+
+            if (!ghostState.isPresent)
+                continue;
+
+            toActor(ghostState, ghost);
+            ghost.mode = ghostState.state >= 0 ? static_cast<GhostMode>(ghostState.state) : GhostMode::Scatter;
+            ghost.houseArrest = ghostState.isLockedInGhostHouse ? std::max(1, toTimer(ghostState.houseArrest)) : 0;
+            ghost.isReversing = false;
+            ghost.isInSlowLane = false;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const MazeLayout& Environment::getLayout() const {
+        return *layout_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const GameParameters& Environment::getParameters() const {
+        return parameters_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const LevelTuning& Environment::getLevelTuning() const {
+        assert(state_.level >= 1 && state_.level <= DifficultyTable::LevelCount && "The game ends after the last level");
+        return parameters_.levels[state_.level - 1];
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::startLevel(int level) {
+        state_.level = level;
+        state_.isBonusStage = level % 4 == 3;
+        state_.pointsMultiplier = 1;
+        state_.scatterWave = 0;
+        state_.chaseWave = 0;
+        state_.bonusStageTimer = 0;
+        state_.starTimer = 0;
+        state_.hasStarAppeared = false;
+        state_.numItemsEaten = 0;
+        state_.numItemsLeft = 0;
+        state_.lockedDoors = 0;
+        state_.items.fill(GameState::NoItem);
+
+        for (int row = 0; row < layout_->getRowCount(); row++) {
+            for (int colm = 0; colm < layout_->getColmCount(); colm++) {
+                auto index = ime::Index{row, colm};
+                std::uint8_t& item = state_.items[MazeLayout::toCell(index)];
+
+                switch (layout_->getTileId(index)) {
+                    case 'F': item = GameState::Fruit;          break;
+                    case 'E': item = GameState::PowerPellet;    break;
+                    case 'S': item = GameState::SuperPellet;    break;
+                    default:
+                        break;
+                }
+
+                if (item != GameState::NoItem)
+                    state_.numItemsLeft++;
+
+                if (int doorId = layout_->getDoorId(index); doorId != 0)
+                    state_.lockedDoors |= std::uint64_t{1} << doorId;
+            }
+        }
+
+        // Shuffled exactly like spm::GameplayScene does, so that keys open the same doors in both
+        auto keyTiles = layout_->getKeyTiles();
+        if (level >= Constants::RANDOM_KEY_POS_LEVEL) {
+            auto randomEngine = std::default_random_engine{static_cast<std::default_random_engine::result_type>(level)};
+            std::shuffle(keyTiles.begin(), keyTiles.end(), randomEngine);
+        }
+
+        for (std::size_t i = 0; i < keyTiles.size(); i++)
+            state_.items[MazeLayout::toCell(keyTiles[i])] = static_cast<std::uint8_t>(GameState::FirstKey + i);
+
+        for (int i = 0; i < 4; i++) {
+            state_.ghosts[i].direction = i == 2 ? Direction::Left : Direction::Right;
+            state_.ghosts[i].houseArrest = (i == 2 || i == 3) ? 1 : 0; // Locked until resetActors starts the arrest timers
+        }
+
+        resetActors();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::resetActors() {
+        state_.pacman.tile = Constants::PacManSpawnTile;
+        state_.pacman.direction = Direction::Left;
+        state_.pacman.credit = 0;
+        state_.pendingDirection = Direction::None;
+
+        for (int i = 0; i < 4; i++) {
+            GameState::Ghost& ghost = state_.ghosts[i];
+            ghost.tile = getSpawnTile(i);
+            ghost.credit = 0;
+            ghost.mode = GhostMode::Scatter;
+            ghost.isReversing = false;
+            ghost.isInSlowLane = false;
+        }
+
+        state_.frightenedTimer = 0;
+        state_.superTimer = 0;
+        state_.starTimer = 0;
+        state_.isModeTimerPaused = false;
+
+        if (state_.isBonusStage)
+            state_.bonusStageTimer = toTicks(Constants::BONUS_STAGE_DURATION);
+        else {
+            auto startHouseArrest = [](GameState::Ghost& ghost, float duration) {
+                if (ghost.houseArrest > 0)
+                    ghost.houseArrest = std::max(0, toTicks(duration));
+            };
+
+            startHouseArrest(state_.ghosts[2], getLevelTuning().inkyHouseArrestDuration);
+            startHouseArrest(state_.ghosts[3], getLevelTuning().clydeHouseArrestDuration);
+            startGhostMode(false);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::movePacMan() {
+        GameState::Actor& pacman = state_.pacman;
+        Direction direction = pacman.direction;
+
+        // Keep pacman moving until he collides with a wall
+        if (state_.pendingDirection != Direction::None && !isPacManBlocked(state_.pendingDirection)) {
+            direction = state_.pendingDirection;
+            state_.pendingDirection = Direction::None;
+        } else if (isPacManBlocked(direction)) {
+            pacman.credit = 0;
+            return;
+        }
+
+        std::array<ime::Index, 5> previousTiles = {pacman.tile, state_.ghosts[0].tile, state_.ghosts[1].tile,
+            state_.ghosts[2].tile, state_.ghosts[3].tile};
+
+        pacman.direction = direction;
+        pacman.tile = getAdjacentTile(pacman.tile, direction);
+
+        if (isLockedDoor(pacman.tile)) { // Only possible in super mode
+            state_.lockedDoors &= ~(std::uint64_t{1} << layout_->getDoorId(pacman.tile));
+            updateScore(Constants::Points::BROKEN_DOOR);
+        }
+
+        if (layout_->isTunnel(pacman.tile))
+            pacman.tile.colm = pacman.tile.colm == 0 ? layout_->getColmCount() - 1 : 0;
+
+        eatItem();
+
+        if (resolveCollisions(-1, previousTiles))
+            return;
+
+        if (state_.numItemsLeft == 0)
+            completeLevel();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::moveGhost(int ghostIndex) {
+        GameState::Ghost& ghost = state_.ghosts[ghostIndex];
+        Direction direction = chooseGhostDirection(ghostIndex);
+        if (direction == Direction::None) {
+            ghost.credit = 0;
+            return;
+        }
+
+        std::array<ime::Index, 5> previousTiles = {state_.pacman.tile, state_.ghosts[0].tile, state_.ghosts[1].tile,
+            state_.ghosts[2].tile, state_.ghosts[3].tile};
+
+        ghost.direction = direction;
+        ghost.tile = getAdjacentTile(ghost.tile, direction);
+
+        // Frightened and eaten ghosts ignore sensors
+        if (ghost.mode == GhostMode::Scatter || ghost.mode == GhostMode::Chase) {
+            if (layout_->isTunnel(ghost.tile))
+                ghost.tile.colm = ghost.tile.colm == 0 ? layout_->getColmCount() - 1 : 0;
+
+            if (int sensor = layout_->getSlowLaneSensorId(ghost.tile); sensor != 0) {
+                ghost.isInSlowLane = ((sensor == 2 || sensor == 4) && direction == Direction::Right) ||
+                                     ((sensor == 1 || sensor == 3) && direction == Direction::Left) ||
+                                     (sensor == 5 && direction == Direction::Up);
+            }
+        } else if (ghost.mode == GhostMode::Eaten && ghost.tile == Constants::EatenGhostRespawnTile)
+            ghost.mode = state_.isChaseMode ? GhostMode::Chase : GhostMode::Scatter;
+
+        resolveCollisions(ghostIndex, previousTiles);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    Direction Environment::chooseGhostDirection(int ghostIndex) {
+        GameState::Ghost& ghost = state_.ghosts[ghostIndex];
+        Direction reverseGhostDir = getOpposite(ghost.direction);
+
+        if (ghost.isReversing) {
+            ghost.isReversing = false;
+
+            if (!isGhostBlocked(ghost, reverseGhostDir))
+                return reverseGhostDir;
+        }
+
+        bool isAllowedInHouse = isAllowedInGhostHouse(ghost);
+        bool preventGoingDown = ghost.tile == SpecialTile || (ghost.tile == Constants::BlinkySpawnTile && !isAllowedInHouse);
+
+        std::array<Direction, 4> possibleDirections{};
+        int numPossibleDirections = 0;
+        for (Direction direction : ghostDirections) {
+            if (direction == reverseGhostDir ||
+                isGhostBlocked(ghost, direction) ||
+                (preventGoingDown && direction == Direction::Down))
+            {
+                continue;
+            }
+
+            possibleDirections[numPossibleDirections++] = direction;
+        }
+
+        if (numPossibleDirections == 0) // Ghost is in a dead end, only option is backwards
+            return isGhostBlocked(ghost, reverseGhostDir) ? Direction::None : reverseGhostDir;
+        else if (numPossibleDirections == 1)
+            return possibleDirections.front();
+
+        bool isInPen = isInGhostHouse(ghost.tile);
+        const Distances* distances = nullptr;
+        ime::Index targetTile;
+
+        if (isInPen && ghost.houseArrest > 0)
+            targetTile = Constants::EatenGhostRespawnTile;
+        else if (isInPen && !isAllowedInHouse) // Kick it out to the front door
+            targetTile = Constants::BlinkySpawnTile;
+        else if (ghost.mode == GhostMode::Frightened || (ghost.mode != GhostMode::Eaten && isPacManSuper(state_)))
+            return possibleDirections[state_.random.nextInt(0, numPossibleDirections - 1)];
+        else {
+            targetTile = getGhostTarget(ghostIndex);
+
+            if (targetTile == Constants::EatenGhostRespawnTile)
+                distances = &respawnDistances_;
+            else if (state_.level >= Constants::SHORTEST_PATH_CHASE_LEVEL && targetTile == state_.pacman.tile)
+                distances = &getPacManDistances();
+        }
+
+        if (distances) {
+            int minDistance = -1;
+            int index = -1;
+            for (int i = 0; i < numPossibleDirections; i++) {
+                ime::Index adjacentTile = getAdjacentTile(ghost.tile, possibleDirections[i]);
+                int distance = layout_->isInBounds(adjacentTile) ? (*distances)[MazeLayout::toCell(adjacentTile)] : -1;
+
+                if (distance != -1 && (index == -1 || distance < minDistance)) {
+                    minDistance = distance;
+                    index = i;
+                }
+            }
+
+            // The target cannot be reached from any adjacent tile (e.g. the ghost is beyond a locked door)
+            if (index != -1)
+                return possibleDirections[index];
+        }
+
+        auto minDistance = std::numeric_limits<double>::max();
+        int index = -1; // Accommodate equal distance condition
+        for (int i = 0; i < numPossibleDirections; i++) {
+            double distance = getDistance(targetTile, getAdjacentTile(ghost.tile, possibleDirections[i]));
+            if (distance < minDistance) {
+                minDistance = distance;
+                index = i;
+            }
+        }
+
+        return index == -1 ? possibleDirections.front() : possibleDirections[index];
+    }
+
+    ///////////////////////////////////////////////////////////////
+    ime::Index Environment::getGhostTarget(int ghostIndex) const {
+        const GameState::Ghost& ghost = state_.ghosts[ghostIndex];
+        if (ghost.mode == GhostMode::Eaten)
+            return Constants::EatenGhostRespawnTile;
+        else if (ghost.mode != GhostMode::Chase)
+            return getScatterTarget(ghostIndex);
+
+        const ime::Index& pacmanTile = state_.pacman.tile;
+        ime::Index pacmanDir = getAdjacentTile(ime::Index{0, 0}, state_.pacman.direction);
+
+        switch (ghostIndex) {
+            case 0: // Blinky
+                return pacmanTile;
+            case 1: { // Pinky
+                auto targetTile = ime::Index{pacmanTile.row + 4 * pacmanDir.row, pacmanTile.colm + 4 * pacmanDir.colm};
+
+                // Mimic the overflow error
+                if (state_.pacman.direction == Direction::Up)
+                    targetTile.colm -= 4;
+
+                return targetTile;
+            }
+            case 2: { // Inky
+                const ime::Index& blinkyTile = state_.ghosts[0].tile;
+                auto pacmanTileOffset = ime::Index{pacmanTile.row + 2 * pacmanDir.row, pacmanTile.colm + 2 * pacmanDir.colm};
+
+                // Mimic the overflow error
+                if (state_.pacman.direction == Direction::Up)
+                    pacmanTileOffset.colm -= 2;
+
+                // The vector from blinky's tile to the offset tile, doubled
+                return ime::Index{2 * pacmanTileOffset.row - blinkyTile.row, 2 * pacmanTileOffset.colm - blinkyTile.colm};
+            }
+            default: { // Clyde
+                const int CLYDE_SHYNESS_DISTANCE = 8; // Distance in tiles
+                if (getDistance(pacmanTile, ghost.tile) > CLYDE_SHYNESS_DISTANCE)
+                    return pacmanTile;
+
+                return Constants::CLYDE_SCATTER_TARGET_TILE;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Environment::isPacManBlocked(Direction direction) const {
+        ime::Index tile = getAdjacentTile(state_.pacman.tile, direction);
+        return !layout_->isInBounds(tile) || layout_->isWall(tile) || (isLockedDoor(tile) && !isPacManSuper(state_));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Environment::isGhostBlocked(const GameState::Ghost& ghost, Direction direction) const {
+        ime::Index tile = getAdjacentTile(ghost.tile, direction);
+        return !layout_->isInBounds(tile) || layout_->isWall(tile) || layout_->isHiddenWall(tile) ||
+            (ghost.mode != GhostMode::Eaten && isLockedDoor(tile));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Environment::isAllowedInGhostHouse(const GameState::Ghost& ghost) const {
+        return ghost.houseArrest > 0 || ghost.mode == GhostMode::Eaten ||
+            (ghost.mode == GhostMode::Chase && isInGhostHouse(state_.pacman.tile));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Environment::isLockedDoor(const ime::Index& index) const {
+        int doorId = layout_->getDoorId(index);
+        return doorId != 0 && (state_.lockedDoors & (std::uint64_t{1} << doorId)) != 0;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::eatItem() {
+        const ime::Index& tile = state_.pacman.tile;
+
+        if (state_.starTimer > 0 && tile == Constants::StarSpawnTile) {
+            int leftFruit = std::min(state_.bonusFruitStopFrame, state_.starAge * 2 * BONUS_FRUIT_FRAME_RATE / Constants::SIMULATION_TICK_RATE);
+            int rightFruit = (state_.starAge * BONUS_FRUIT_FRAME_RATE / Constants::SIMULATION_TICK_RATE) % NUM_BONUS_FRUITS;
+
+            if (leftFruit == rightFruit) {
+                if (leftFruit == state_.level - 1)
+                    updateScore(Constants::Points::MATCHING_BONUS_FRUIT_AND_LEVEL_FRUIT);
+                else
+                    updateScore(Constants::Points::MATCHING_BONUS_FRUIT);
+            } else
+                updateScore(Constants::Points::GHOST * state_.pointsMultiplier);
+
+            state_.starTimer = 0;
+        }
+
+        std::uint8_t& item = state_.items[MazeLayout::toCell(tile)];
+        if (item == GameState::NoItem)
+            return;
+
+        std::uint8_t eatenItem = std::exchange(item, GameState::NoItem);
+        if (eatenItem >= GameState::FirstKey) {
+            int keyId = eatenItem - GameState::FirstKey + 1;
+            for (int doorId = 1; doorId <= layout_->getDoorCount(); doorId++) {
+                if (isDoorKey(keyId, doorId))
+                    state_.lockedDoors &= ~(std::uint64_t{1} << doorId);
+            }
+
+            updateScore(Constants::Points::KEY);
+            return;
+        }
+
+        state_.numItemsEaten++;
+        state_.numItemsLeft--;
+
+        if (eatenItem == GameState::Fruit)
+            updateScore(Constants::Points::FRUIT * state_.level);
+        else if (eatenItem == GameState::PowerPellet) {
+            state_.isModeTimerPaused = true;
+            updateScore(Constants::Points::POWER_PELLET);
+
+            int duration = toTicks(getLevelTuning().frightenedDuration);
+            if (!state_.isBonusStage)
+                state_.frightenedTimer += duration;
+
+            // Extend super mode duration by power mode duration
+            if (state_.superTimer > 0)
+                state_.superTimer += duration;
+
+            for (auto& ghost : state_.ghosts) {
+                ghost.isReversing = true;
+
+                if (duration > 0 && (ghost.mode == GhostMode::Scatter || ghost.mode == GhostMode::Chase)) {
+                    ghost.mode = GhostMode::Frightened;
+                    ghost.isInSlowLane = false;
+                }
+            }
+
+            if (!state_.isBonusStage && state_.frightenedTimer == 0)
+                endPowerMode();
+        } else if (eatenItem == GameState::SuperPellet) {
+            state_.isModeTimerPaused = true;
+            updateScore(Constants::Points::SUPER_PELLET);
+
+            if (!state_.isBonusStage)
+                state_.superTimer += toTicks(getLevelTuning().superDuration);
+        }
+
+        if (!state_.hasStarAppeared && state_.numItemsEaten == Constants::STAR_SPAWN_EATEN_ITEMS) {
+            state_.hasStarAppeared = true;
+            state_.starTimer = toTicks(Constants::STAR_ON_SCREEN_TIME);
+            state_.starAge = 0;
+            state_.bonusFruitStopFrame = state_.random.nextInt(0, NUM_BONUS_FRUITS - 1);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Environment::resolveCollisions(int ghostIndex, const std::array<ime::Index, 5>& previousTiles) {
+        const GameState::Actor& pacman = state_.pacman;
+        bool isFrightenedGhostEaten = false;
+
+        for (int i = 0; i < 4; i++) {
+            if (state_.isBonusStage || (ghostIndex != -1 && ghostIndex != i))
+                continue;
+
+            // Actors that swap tiles pass through each other between two substeps
+            GameState::Ghost& ghost = state_.ghosts[i];
+            if (ghost.tile != pacman.tile && (ghost.tile != previousTiles[0] || pacman.tile != previousTiles[i + 1]))
+                continue;
+
+            if (ghost.mode == GhostMode::Frightened) {
+                updateScore(Constants::Points::GHOST * state_.pointsMultiplier);
+                state_.pointsMultiplier = state_.pointsMultiplier == 8 ? 1 : state_.pointsMultiplier * 2;
+                ghost.mode = GhostMode::Eaten;
+                isFrightenedGhostEaten = true;
+            } else if (ghost.mode != GhostMode::Eaten && !isPacManSuper(state_)) {
+                state_.lives--;
+                isLevelInterrupted_ = true;
+
+                if (state_.lives <= 0)
+                    state_.isGameOver = true;
+                else
+                    resetActors();
+
+                return true;
+            }
+        }
+
+        if (isFrightenedGhostEaten) {
+            bool isSomeGhostsBlue = std::any_of(state_.ghosts.begin(), state_.ghosts.end(), [](const GameState::Ghost& ghost) {
+                return ghost.mode == GhostMode::Frightened;
+            });
+
+            if (!isSomeGhostsBlue && state_.frightenedTimer > 0) {
+                state_.frightenedTimer = 0;
+                endPowerMode();
+            }
+        }
+
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::updateScore(int points) {
+        state_.score += points;
+
+        if ((state_.score >= Constants::FIRST_EXTRA_LIFE_MIN_SCORE && state_.extraLivesWon == 0) ||
+            (state_.score >= Constants::SECOND_EXTRA_LIFE_MIN_SCORE && state_.extraLivesWon == 1) ||
+            (state_.score >= Constants::THIRD_EXTRA_LIFE_MIN_SCORE && state_.extraLivesWon == 2))
+        {
+            state_.extraLivesWon++;
+            state_.lives++;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::updateTimers() {
+        auto countDown = [](int& timer) {
+            if (timer <= 0)
+                return false;
+
+            timer = std::max(0, timer - STEP_TICKS);
+            return timer == 0;
+        };
+
+        for (auto& ghost : state_.ghosts)
+            countDown(ghost.houseArrest);
+
+        if (state_.starTimer > 0) {
+            state_.starAge += STEP_TICKS;
+            countDown(state_.starTimer);
+        }
+
+        if (countDown(state_.frightenedTimer))
+            endPowerMode();
+
+        if (countDown(state_.superTimer))
+            endSuperMode();
+
+        if (!state_.isModeTimerPaused && countDown(state_.modeTimer)) {
+            if (state_.isChaseMode) {
+                state_.scatterWave = std::min(state_.scatterWave + 1, 4);
+                startGhostMode(false);
+            } else {
+                state_.chaseWave = std::min(state_.chaseWave + 1, 4);
+                startGhostMode(true);
+            }
+        }
+
+        if (countDown(state_.bonusStageTimer))
+            completeLevel();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::startGhostMode(bool isChaseMode) {
+        state_.isChaseMode = isChaseMode;
+
+        // A scatter wave of 0 seconds lasts a single tick
+        if (isChaseMode)
+            state_.modeTimer = toTicks(getLevelTuning().chaseDurations[state_.chaseWave]);
+        else
+            state_.modeTimer = std::max(1, toTicks(getLevelTuning().scatterDurations[state_.scatterWave]));
+
+        GhostMode from = isChaseMode ? GhostMode::Scatter : GhostMode::Chase;
+        for (auto& ghost : state_.ghosts) {
+            if (ghost.mode == from) {
+                ghost.mode = isChaseMode ? GhostMode::Chase : GhostMode::Scatter;
+                ghost.isReversing = true;
+                ghost.isInSlowLane = false;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::endPowerMode() {
+        state_.pointsMultiplier = 1;
+        state_.isModeTimerPaused = state_.superTimer > 0;
+
+        for (auto& ghost : state_.ghosts) {
+            if (ghost.mode == GhostMode::Frightened)
+                ghost.mode = state_.isChaseMode ? GhostMode::Chase : GhostMode::Scatter;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::endSuperMode() {
+        state_.isModeTimerPaused = false;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::completeLevel() {
+        updateScore(state_.bonusStageTimer * 1000 / Constants::SIMULATION_TICK_RATE);
+        isLevelInterrupted_ = true;
+
+        if (state_.level == LAST_LEVEL)
+            state_.isGameOver = true;
+        else
+            startLevel(state_.level + 1);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Environment::computeDistances(const ime::Index& source, bool isDoorObstacle, Distances& distances) const {
+        distances.fill(-1);
+
+        if (!layout_->isInBounds(source))
+            return;
+
+        int numRows = layout_->getRowCount();
+        int numColms = layout_->getColmCount();
+        auto isBlocked = [&](int row, int colm) {
+            auto index = ime::Index{row, colm};
+            return layout_->isWall(index) || layout_->isHiddenWall(index) || (isDoorObstacle && isLockedDoor(index));
+        };
+
+        std::array<ime::Index, MazeLayout::MaxRows * MazeLayout::MaxColms> frontier;
+        int head = 0, tail = 0;
+        distances[MazeLayout::toCell(source)] = 0;
+        frontier[tail++] = source;
+
+        while (head < tail) {
+            ime::Index index = frontier[head++];
+            std::int16_t distance = distances[MazeLayout::toCell(index)];
+
+            // Wraps around the left and right edges like spm::DistanceField
+            const ime::Index neighbours[] = {
+                {index.row - 1, index.colm},
+                {index.row + 1, index.colm},
+                {index.row, index.colm == 0 ? numColms - 1 : index.colm - 1},
+                {index.row, index.colm == numColms - 1 ? 0 : index.colm + 1}
+            };
+
+            for (const ime::Index& neighbour : neighbours) {
+                if (neighbour.row < 0 || neighbour.row >= numRows || isBlocked(neighbour.row, neighbour.colm))
+                    continue;
+
+                std::int16_t& neighbourDistance = distances[MazeLayout::toCell(neighbour)];
+                if (neighbourDistance == -1) {
+                    neighbourDistance = static_cast<std::int16_t>(distance + 1);
+                    frontier[tail++] = neighbour;
+                }
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const Environment::Distances& Environment::getPacManDistances() {
+        if (!isPacManDistancesValid_ || pacmanDistancesSource_ != state_.pacman.tile || pacmanDistancesDoors_ != state_.lockedDoors) {
+            computeDistances(state_.pacman.tile, true, pacmanDistances_);
+            pacmanDistancesSource_ = state_.pacman.tile;
+            pacmanDistancesDoors_ = state_.lockedDoors;
+            isPacManDistancesValid_ = true;
+        }
+
+        return pacmanDistances_;
+    }
+
+} // namespace spm
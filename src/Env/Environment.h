@@ -0,0 +1,282 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_ENVIRONMENT_H
+#define SUPERPACMAN_ENVIRONMENT_H
+
+#include "GameState.h"
+#include "GameParameters.h"
+#include "MazeLayout.h"
+#include "Session/SessionState.h"
+#include <array>
+#include <memory>
+
+namespace spm {
+    /**
+     * @brief Headless, step-driven model of the gameplay
+     *
+     * The environment plays the game without a window, scenes or game
+     * objects so that bots can be trained against it. Each step lasts as
+     * long as pacman takes to cross one tile at his normal speed and
+     * applies the rules of spm::GameplayScene: the ghost modes and their
+     * timers, the ghost house, the ghost movement of spm::GhostGridMover,
+     * keys, doors, pellets, the star, bonus stages and extra lives.
+     *
+     * The level start countdown, freezes after a ghost or the star is
+     * eaten and all animations are skipped, since they do not change the
+     * outcome of a game, and timers expire at the end of the step in which
+     * they run out. The ParityCheck tool replays the moves of pacman in
+     * traces recorded by the game (see spm::SessionTrace) to check that
+     * the environment still agrees with the scene
+     *
+     * The environment is copyable. Copies share the maze layout and step
+     * independently from one another
+     */
+    class Environment {
+    public:
+        /**
+         * @brief The result of a step
+         */
+        struct StepResult {
+            const GameState& observation;   //!< The state of the game after the step
+            int reward;                     //!< The points scored during the step
+            bool done;                      //!< True if the game is over
+        };
+
+        /**
+         * @brief Constructor
+         * @param layout The maze to play on
+         * @param parameters The gameplay tuning values to play with
+         *
+         * The environment must be reset before it is stepped
+         */
+        explicit Environment(std::shared_ptr<const MazeLayout> layout, const GameParameters& parameters = GameParameters());
+
+        /**
+         * @brief Start a new game
+         * @param seed The seed of the ghosts' random moves
+         * @param level The level to start on, in the range [1, 16]
+         * @return The initial state of the game
+         *
+         * Games that start with the same seed on the same level play out
+         * identically when given the same actions
+         */
+        const GameState& reset(std::uint64_t seed, int level = 1);
+
+        /**
+         * @brief Advance the game by one step
+         * @param action The direction to steer pacman in
+         * @return The state after the step, the points scored during the
+         *         step and whether the game is over
+         *
+         * Stepping a game that is over has no effect
+         */
+        StepResult step(Action action);
+
+        /**
+         * @brief Get the state of the game
+         * @return The state of the game
+         */
+        const GameState& getState() const;
+
+        /**
+         * @brief Continue from a saved state
+         * @param state A state returned by spm::Environment::getState
+         *
+         * @a state must have been played on the same maze layout
+         */
+        void setState(const GameState& state);
+
+        /**
+         * @brief Continue from a state captured in the game
+         * @param session A state captured by spm::GameplayScene::captureState
+         *
+         * Actors that are between two tiles are placed on the tile they
+         * are closest to. The game does not record how long the star has
+         * left to be seen or where the bonus fruits stop, so a star that
+         * is on the maze is assumed to have just appeared and its left
+         * bonus fruit is assumed to stop on the last frame
+         */
+        void setState(const SessionState& session);
+
+        /**
+         * @brief Get the maze the game is played on
+         * @return The maze layout
+         */
+        const MazeLayout& getLayout() const;
+
+        /**
+         * @brief Get the gameplay tuning values the environment plays with
+         * @return The gameplay tuning values
+         */
+        const GameParameters& getParameters() const;
+
+        /**
+         * @brief Check if pacman is blocked in a direction
+         * @param direction The direction to check
+         * @return True if pacman cannot move in @a direction
+         */
+        bool isPacManBlocked(Direction direction) const;
+
+    private:
+        using Distances = std::array<std::int16_t, MazeLayout::MaxRows * MazeLayout::MaxColms>;
+
+        /**
+         * @brief Set up a level
+         * @param level The level to set up
+         */
+        void startLevel(int level);
+
+        /**
+         * @brief Put the actors back on their spawn tiles and restart the timers
+         *
+         * This function is called when a level starts and after pacman dies
+         */
+        void resetActors();
+
+        /**
+         * @brief Move pacman by one tile
+         */
+        void movePacMan();
+
+        /**
+         * @brief Move a ghost by one tile
+         * @param ghostIndex The index of the ghost to move
+         */
+        void moveGhost(int ghostIndex);
+
+        /**
+         * @brief Choose the direction a ghost moves in from its tile
+         * @param ghostIndex The index of the ghost
+         * @return The chosen direction or spm::Direction::None if the ghost cannot move
+         */
+        Direction chooseGhostDirection(int ghostIndex);
+
+        /**
+         * @brief Get the tile a ghost is heading to
+         * @param ghostIndex The index of the ghost
+         * @return The tile the ghost is heading to
+         */
+        ime::Index getGhostTarget(int ghostIndex) const;
+
+        /**
+         * @brief Check if a ghost is blocked in a direction
+         * @param ghost The ghost to check
+         * @param direction The direction to check
+         * @return True if @a ghost cannot move in @a direction
+         */
+        bool isGhostBlocked(const GameState::Ghost& ghost, Direction direction) const;
+
+        /**
+         * @brief Check if a ghost may be in the ghost house
+         * @param ghost The ghost to check
+         * @return True if @a ghost may be in the ghost house
+         */
+        bool isAllowedInGhostHouse(const GameState::Ghost& ghost) const;
+
+        /**
+         * @brief Check if a door is locked
+         * @param index The tile to check
+         * @return True if there is a locked door on the tile
+         */
+        bool isLockedDoor(const ime::Index& index) const;
+
+        /**
+         * @brief Eat the item on pacman's tile
+         */
+        void eatItem();
+
+        /**
+         * @brief Resolve a collision between pacman and the ghosts
+         * @param ghostIndex The ghost that moved or -1 if pacman moved
+         * @param previousTiles The tiles the actors were on before the move
+         * @return True if pacman died
+         */
+        bool resolveCollisions(int ghostIndex, const std::array<ime::Index, 5>& previousTiles);
+
+        /**
+         * @brief Add points to the score and award extra lives
+         * @param points The points to add
+         */
+        void updateScore(int points);
+
+        /**
+         * @brief Advance the timers by one step
+         */
+        void updateTimers();
+
+        /**
+         * @brief Get the tuning values of the current level
+         * @return The tuning values of the current level
+         */
+        const LevelTuning& getLevelTuning() const;
+
+        /**
+         * @brief Switch between scatter and chase mode
+         * @param isChaseMode True to start chasing, false to start scattering
+         */
+        void startGhostMode(bool isChaseMode);
+
+        /**
+         * @brief Handle the end of power mode
+         */
+        void endPowerMode();
+
+        /**
+         * @brief Handle the end of super mode
+         */
+        void endSuperMode();
+
+        /**
+         * @brief Handle the clearing of a level
+         */
+        void completeLevel();
+
+        /**
+         * @brief Compute the number of steps from every tile to a source tile
+         * @param source The tile to compute the distances to
+         * @param isDoorObstacle True if locked doors block the search
+         * @param distances The buffer to write the distances to
+         */
+        void computeDistances(const ime::Index& source, bool isDoorObstacle, Distances& distances) const;
+
+        /**
+         * @brief Get the distances from every tile to pacman's tile
+         * @return The distances, walking around locked doors
+         */
+        const Distances& getPacManDistances();
+
+    private:
+        std::shared_ptr<const MazeLayout> layout_; //!< The maze the game is played on
+        GameParameters parameters_;                //!< The gameplay tuning values
+        GameState state_;                          //!< The state of the game
+        bool isLevelInterrupted_;                  //!< True if pacman died or the level ended during the current step
+        Distances respawnDistances_;               //!< Distances to the tile eaten ghosts are revived on
+        Distances pacmanDistances_;                //!< Distances to pacman's tile (Computed on demand)
+        ime::Index pacmanDistancesSource_;         //!< The tile pacmanDistances_ was computed from
+        std::uint64_t pacmanDistancesDoors_;       //!< The doors that were locked when pacmanDistances_ was computed
+        bool isPacManDistancesValid_;              //!< False if pacmanDistances_ has not been computed
+    };
+}
+
+#endif
@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "GameParameters.h"
+#include <cstdlib>
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    bool GameParameters::set(const std::string& name, float value) {
+        if (name == "pacmanSpeed") {
+            pacmanSpeed = value;
+            return true;
+        }
+
+        std::string::size_type at = name.find('@');
+        std::string valueName = name.substr(0, at);
+        int first = 1, last = DifficultyTable::LevelCount;
+
+        if (at != std::string::npos) {
+            char* end = nullptr;
+            first = last = static_cast<int>(std::strtol(name.c_str() + at + 1, &end, 10));
+            if (*end != '\0' || end == name.c_str() + at + 1 || first < 1 || first > DifficultyTable::LevelCount)
+                return false;
+        }
+
+        for (int level = first; level <= last; level++) {
+            float* member = levels[level - 1].findValue(valueName);
+            if (!member)
+                return false;
+
+            *member = value;
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::vector<std::string> GameParameters::getNames() {
+        std::vector<std::string> names = LevelTuning::getValueNames();
+        names.insert(names.begin(), "pacmanSpeed");
+        return names;
+    }
+
+} // namespace spm
@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_GAMEPARAMETERS_H
+#define SUPERPACMAN_GAMEPARAMETERS_H
+
+#include "Common/Constants.h"
+#include "Common/DifficultyTable.h"
+#include <string>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Gameplay tuning values of the environment
+     *
+     * The defaults are the values the game is played with
+     */
+    struct GameParameters {
+        DifficultyTable::Levels levels = DesignedDifficulty;  //!< Tuning values of each level, the first level is at index 0
+        float pacmanSpeed = Constants::PacManNormalSpeed;     //!< Pacmans normal speed in pixels per second
+
+        /**
+         * @brief Set a parameter by name
+         * @param name "pacmanSpeed" or the name of a spm::LevelTuning value
+         *             (see spm::LevelTuning::findValue), optionally followed
+         *             by "@" and a level (e.g. "chaseSpeed@5") to only set
+         *             the value of that level instead of every level
+         * @param value The new value of the parameter
+         * @return True if the parameter was set or false if there is no
+         *         parameter called @a name
+         */
+        bool set(const std::string& name, float value);
+
+        /**
+         * @brief Get the names of all parameters
+         * @return The names of all parameters without a level
+         */
+        static std::vector<std::string> getNames();
+    };
+}
+
+#endif
@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_GAMESTATE_H
+#define SUPERPACMAN_GAMESTATE_H
+
+#include "MazeLayout.h"
+#include "Common/Random.h"
+#include <IME/core/grid/Index.h>
+#include <array>
+#include <cstdint>
+
+namespace spm {
+    /**
+     * @brief The direction an actor faces or moves in
+     */
+    enum class Direction : std::uint8_t {
+        None,   //!< No direction
+        Up,     //!< Towards the top of the maze
+        Left,   //!< Towards the left of the maze
+        Down,   //!< Towards the bottom of the maze
+        Right   //!< Towards the right of the maze
+    };
+
+    /**
+     * @brief The direction pacman is steered in during a step
+     *
+     * spm::Direction::None keeps pacman going the way he is going, like
+     * not pressing any key in the game
+     */
+    using Action = Direction;
+
+    /**
+     * @brief The mode of a ghost
+     */
+    enum class GhostMode : std::uint8_t {
+        Scatter,    //!< Heads to its corner of the maze
+        Chase,      //!< Hunts pacman
+        Frightened, //!< Wanders randomly and can be eaten
+        Eaten       //!< Returns to the ghost house to be revived
+    };
+
+    /**
+     * @brief The complete state of a headless game
+     *
+     * The state is a plain value without any pointers, so it can be copied,
+     * stored and restored freely. A copy of the state continues exactly
+     * like the original when given the same actions. All durations are
+     * counted in simulation ticks (see Constants::SIMULATION_TICK_RATE)
+     */
+    struct GameState {
+        /**
+         * @brief The contents of a tile that pacman can eat
+         *
+         * Keys are stored as FirstKey + (key id - 1)
+         */
+        enum Item : std::uint8_t {
+            NoItem,         //!< Nothing to eat
+            Fruit,          //!< A level fruit
+            PowerPellet,    //!< A power pellet
+            SuperPellet,    //!< A super pellet
+            FirstKey = 16   //!< Key number 1
+        };
+
+        /**
+         * @brief An actor that moves tile by tile
+         */
+        struct Actor {
+            ime::Index tile;        //!< The tile the actor is on
+            Direction direction;    //!< The direction the actor is facing
+            int credit;             //!< Progress towards the next tile (Percentage of a tile)
+        };
+
+        /**
+         * @brief A ghost
+         */
+        struct Ghost : Actor {
+            GhostMode mode;         //!< The mode of the ghost
+            int houseArrest;        //!< Time left locked in the ghost house (Locked while positive)
+            bool isReversing;       //!< True if the ghost turns around on its next move
+            bool isInSlowLane;      //!< True if the ghost is slowed down by a slow lane
+        };
+
+        Random random;                  //!< Source of all randomness in the game
+        std::uint64_t tick;             //!< Number of simulation ticks since the game started
+        int level;                      //!< The current level
+        int score;                      //!< The player's score
+        int lives;                      //!< The player's remaining lives
+        int extraLivesWon;              //!< The number of extra lives awarded so far
+        int pointsMultiplier;           //!< Multiplier of the points for the next ghost eaten
+        int scatterWave;                //!< The number of times the ghosts have scattered (Capped at 4)
+        int chaseWave;                  //!< The number of times the ghosts have chased (Capped at 4)
+        int modeTimer;                  //!< Time left in the current scatter or chase mode
+        int frightenedTimer;            //!< Time left in power mode (Zero when not running)
+        int superTimer;                 //!< Time left in super mode (Zero when not running)
+        int bonusStageTimer;            //!< Time left to clear a bonus stage (Zero when not running)
+        int starTimer;                  //!< Time left before the star disappears (Zero when not on the maze)
+        int starAge;                    //!< Time since the star appeared
+        int bonusFruitStopFrame;        //!< The frame the left bonus fruit stops on
+        int numItemsEaten;              //!< Number of fruits and pellets eaten on this level
+        int numItemsLeft;               //!< Number of fruits and pellets left on this level
+        bool isBonusStage;              //!< True if the level is a bonus stage
+        bool isChaseMode;               //!< True if ghosts are chasing, otherwise they are scattering
+        bool isModeTimerPaused;         //!< True if the scatter and chase timer is paused by a pellet
+        bool hasStarAppeared;           //!< True if the star has already appeared on this level
+        bool isGameOver;                //!< True if the game has ended
+        Direction pendingDirection;     //!< Direction pacman turns to as soon as he can
+        Actor pacman;                   //!< Pacman
+        std::array<Ghost, 4> ghosts;    //!< Blinky, Pinky, Inky and Clyde
+        std::uint64_t lockedDoors;      //!< Bit n is set if door n is locked
+        std::array<std::uint8_t, MazeLayout::MaxRows * MazeLayout::MaxColms> items; //!< The item on each tile
+    };
+}
+
+#endif
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "MazeLayout.h"
+#include <fstream>
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    bool MazeLayout::loadFromFile(const std::string& filename) {
+        auto rows = std::vector<std::string>();
+        auto file = std::ifstream(filename);
+        auto line = std::string();
+        while (std::getline(file, line)) {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            if (line.empty() || line.front() == '#')
+                continue;
+
+            if (!rows.empty() && line.size() != rows.front().size())
+                return false;
+
+            rows.push_back(line);
+        }
+
+        if (rows.empty() || rows.size() > MaxRows || rows.front().size() > MaxColms)
+            return false;
+
+        *this = MazeLayout();
+        numRows_ = static_cast<int>(rows.size());
+        numColms_ = static_cast<int>(rows.front().size());
+        tileIds_.fill('.');
+
+        int numSensors = 0;
+        for (int row = 0; row < numRows_; row++) {
+            for (int colm = 0; colm < numColms_; colm++) {
+                char id = rows[row][colm];
+                int cell = toCell({row, colm});
+                tileIds_[cell] = id;
+
+                if (id == 'D' || id == '+') {
+                    if (numDoors_ == MaxDoors)
+                        return false;
+
+                    doorIds_[cell] = static_cast<std::uint8_t>(++numDoors_);
+                }
+
+                if (id == 'H' || id == '+')
+                    sensorIds_[cell] = static_cast<std::uint8_t>(++numSensors);
+                else if (id == 'K')
+                    keyTiles_.push_back({row, colm});
+            }
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int MazeLayout::getRowCount() const {
+        return numRows_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int MazeLayout::getColmCount() const {
+        return numColms_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool MazeLayout::isInBounds(const ime::Index& index) const {
+        return index.row >= 0 && index.row < numRows_ && index.colm >= 0 && index.colm < numColms_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    char MazeLayout::getTileId(const ime::Index& index) const {
+        return isInBounds(index) ? tileIds_[toCell(index)] : '.';
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool MazeLayout::isWall(const ime::Index& index) const {
+        char id = getTileId(index);
+        return id == '|' || id == '#';
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool MazeLayout::isHiddenWall(const ime::Index& index) const {
+        return getTileId(index) == 'N';
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool MazeLayout::isTunnel(const ime::Index& index) const {
+        return getTileId(index) == 'T';
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int MazeLayout::getDoorId(const ime::Index& index) const {
+        return isInBounds(index) ? doorIds_[toCell(index)] : 0;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int MazeLayout::getDoorCount() const {
+        return numDoors_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int MazeLayout::getSlowLaneSensorId(const ime::Index& index) const {
+        return isInBounds(index) ? sensorIds_[toCell(index)] : 0;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const std::vector<ime::Index>& MazeLayout::getKeyTiles() const {
+        return keyTiles_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int MazeLayout::toCell(const ime::Index& index) {
+        return index.row * MaxColms + index.colm;
+    }
+
+} // namespace spm
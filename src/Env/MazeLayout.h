@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_MAZELAYOUT_H
+#define SUPERPACMAN_MAZELAYOUT_H
+
+#include <IME/core/grid/Index.h>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief The static layout of the gameplay maze
+     *
+     * The layout is read from the same maze file as spm::Grid, but without
+     * creating any game objects, so it can be loaded without a window and
+     * shared by any number of headless environments. Doors, keys and slow
+     * lane sensors are numbered from 1 in the order in which they appear
+     * in the file, row by row, which is the order in which the gameplay
+     * scene creates them
+     */
+    class MazeLayout {
+    public:
+        static constexpr int MaxRows = 32;      //!< Maximum number of rows in a maze
+        static constexpr int MaxColms = 32;     //!< Maximum number of columns in a maze
+        static constexpr int MaxDoors = 63;     //!< Maximum number of doors in a maze
+
+        /**
+         * @brief Load a maze file
+         * @param filename The name of the file to load
+         * @return True if the file was loaded, or false if it could not be
+         *         read or does not fit the maximum maze size
+         *
+         * Lines that start with '#' are comments
+         */
+        bool loadFromFile(const std::string& filename);
+
+        /**
+         * @brief Get the number of rows in the maze
+         * @return The number of rows in the maze
+         */
+        int getRowCount() const;
+
+        /**
+         * @brief Get the number of columns in the maze
+         * @return The number of columns in the maze
+         */
+        int getColmCount() const;
+
+        /**
+         * @brief Check if a tile is inside the maze
+         * @param index The index of the tile
+         * @return True if the tile is inside the maze, otherwise false
+         */
+        bool isInBounds(const ime::Index& index) const;
+
+        /**
+         * @brief Get the id of a tile as it appears in the maze file
+         * @param index The index of the tile
+         * @return The id of the tile or '.' if @a index is outside the maze
+         */
+        char getTileId(const ime::Index& index) const;
+
+        /**
+         * @brief Check if a tile is a wall
+         * @param index The index of the tile
+         * @return True if the tile is a wall, otherwise false
+         *
+         * Hidden walls are not included
+         *
+         * @see isHiddenWall
+         */
+        bool isWall(const ime::Index& index) const;
+
+        /**
+         * @brief Check if a tile is a wall that only pacman can pass through
+         * @param index The index of the tile
+         * @return True if the tile is a hidden wall, otherwise false
+         */
+        bool isHiddenWall(const ime::Index& index) const;
+
+        /**
+         * @brief Check if a tile is a tunnel exit
+         * @param index The index of the tile
+         * @return True if the tile is a tunnel exit, otherwise false
+         */
+        bool isTunnel(const ime::Index& index) const;
+
+        /**
+         * @brief Get the id of the door on a tile
+         * @param index The index of the tile
+         * @return The id of the door or 0 if there is no door on the tile
+         */
+        int getDoorId(const ime::Index& index) const;
+
+        /**
+         * @brief Get the number of doors in the maze
+         * @return The number of doors in the maze
+         */
+        int getDoorCount() const;
+
+        /**
+         * @brief Get the id of the slow lane sensor on a tile
+         * @param index The index of the tile
+         * @return The id of the sensor or 0 if there is no sensor on the tile
+         */
+        int getSlowLaneSensorId(const ime::Index& index) const;
+
+        /**
+         * @brief Get the initial positions of the keys
+         * @return The tiles of the keys, the first tile belongs to key 1
+         */
+        const std::vector<ime::Index>& getKeyTiles() const;
+
+        /**
+         * @brief Convert a tile index to a position in a flat per-tile buffer
+         * @param index The index of the tile
+         * @return The position of the tile in a buffer of MaxRows * MaxColms
+         */
+        static int toCell(const ime::Index& index);
+
+    private:
+        int numRows_ = 0;                                       //!< The number of rows in the maze
+        int numColms_ = 0;                                      //!< The number of columns in the maze
+        int numDoors_ = 0;                                      //!< The number of doors in the maze
+        std::array<char, MaxRows * MaxColms> tileIds_{};        //!< The id of each tile
+        std::array<std::uint8_t, MaxRows * MaxColms> doorIds_{};     //!< The id of the door on each tile
+        std::array<std::uint8_t, MaxRows * MaxColms> sensorIds_{};   //!< The id of the slow lane sensor on each tile
+        std::vector<ime::Index> keyTiles_;                      //!< The initial tile of each key
+    };
+}
+
+#endif
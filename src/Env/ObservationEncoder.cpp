@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "ObservationEncoder.h"
+#include "Common/Constants.h"
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SPM_OBSERVATION_ENCODER_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace spm {
+    namespace {
+        static_assert(MazeLayout::MaxColms == 32, "A row of a bit plane must fit in a 32-bit word");
+
+        ///////////////////////////////////////////////////////////////
+        void setBit(std::uint32_t* plane, const ime::Index& index) {
+            if (index.row >= 0 && index.row < MazeLayout::MaxRows && index.colm >= 0 && index.colm < MazeLayout::MaxColms)
+                plane[index.row] |= std::uint32_t{1} << index.colm;
+        }
+
+        ///////////////////////////////////////////////////////////////
+        std::uint32_t* getPlane(std::uint32_t* planes, ObservationEncoder::Plane plane) {
+            return planes + plane * MazeLayout::MaxRows;
+        }
+    } // namespace anonymous
+
+    ///////////////////////////////////////////////////////////////
+    ObservationEncoder::ObservationEncoder(const MazeLayout& layout) :
+        numRows_{layout.getRowCount()},
+        numColms_{layout.getColmCount()}
+    {
+        for (int row = 0; row < numRows_; row++) {
+            for (int colm = 0; colm < numColms_; colm++) {
+                auto index = ime::Index{row, colm};
+
+                if (layout.isWall(index))
+                    setBit(walls_.data(), index);
+                else if (layout.isHiddenWall(index))
+                    setBit(hiddenWalls_.data(), index);
+                else if (layout.getTileId(index) == '?')
+                    setBit(bonusFruits_.data(), index);
+
+                if (int doorId = layout.getDoorId(index); doorId != 0)
+                    doorTiles_[doorId] = index;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t ObservationEncoder::getByteBufferSize() const {
+        return static_cast<std::size_t>(PlaneCount) * numRows_ * numColms_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ObservationEncoder::encodeBits(const GameState& state, std::uint32_t* planes) const {
+        std::memset(planes, 0, getBitBufferSize() * sizeof(std::uint32_t));
+        std::memcpy(getPlane(planes, Walls), walls_.data(), sizeof(walls_));
+        std::memcpy(getPlane(planes, HiddenWalls), hiddenWalls_.data(), sizeof(hiddenWalls_));
+
+        // Items are stored MaxColms to a row, so each row of items becomes one word per plane
+        std::uint32_t* fruits = getPlane(planes, Fruits);
+        std::uint32_t* powerPellets = getPlane(planes, PowerPellets);
+        std::uint32_t* superPellets = getPlane(planes, SuperPellets);
+        std::uint32_t* keys = getPlane(planes, Keys);
+        const std::uint8_t* items = state.items.data();
+
+#ifdef SPM_OBSERVATION_ENCODER_SSE2
+        const __m128i fruit = _mm_set1_epi8(GameState::Fruit);
+        const __m128i powerPellet = _mm_set1_epi8(GameState::PowerPellet);
+        const __m128i superPellet = _mm_set1_epi8(GameState::SuperPellet);
+        const __m128i firstKey = _mm_set1_epi8(static_cast<char>(GameState::FirstKey));
+
+        auto toMask = [](__m128i low, __m128i high) {
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(low)) | (static_cast<std::uint32_t>(_mm_movemask_epi8(high)) << 16);
+        };
+
+        for (int row = 0; row < numRows_; row++) {
+            __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(items + row * MazeLayout::MaxColms));
+            __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(items + row * MazeLayout::MaxColms + 16));
+
+            fruits[row] = toMask(_mm_cmpeq_epi8(low, fruit), _mm_cmpeq_epi8(high, fruit));
+            powerPellets[row] = toMask(_mm_cmpeq_epi8(low, powerPellet), _mm_cmpeq_epi8(high, powerPellet));
+            superPellets[row] = toMask(_mm_cmpeq_epi8(low, superPellet), _mm_cmpeq_epi8(high, superPellet));
+
+            // Unsigned comparison: x >= FirstKey if max(x, FirstKey) == x
+            keys[row] = toMask(_mm_cmpeq_epi8(_mm_max_epu8(low, firstKey), low), _mm_cmpeq_epi8(_mm_max_epu8(high, firstKey), high));
+        }
+#else
+        for (int row = 0; row < numRows_; row++) {
+            for (int colm = 0; colm < numColms_; colm++) {
+                std::uint8_t item = items[row * MazeLayout::MaxColms + colm];
+                std::uint32_t bit = std::uint32_t{1} << colm;
+
+                if (item == GameState::Fruit)
+                    fruits[row] |= bit;
+                else if (item == GameState::PowerPellet)
+                    powerPellets[row] |= bit;
+                else if (item == GameState::SuperPellet)
+                    superPellets[row] |= bit;
+                else if (item >= GameState::FirstKey)
+                    keys[row] |= bit;
+            }
+        }
+#endif
+
+        std::uint32_t* lockedDoors = getPlane(planes, LockedDoors);
+        std::uint64_t doors = state.lockedDoors;
+        for (int doorId = 0; doors != 0; doorId++, doors >>= 1) {
+            if (doors & 1)
+                setBit(lockedDoors, doorTiles_[doorId]);
+        }
+
+        setBit(getPlane(planes, PacMan), state.pacman.tile);
+
+        if (!state.isBonusStage) {
+            for (int i = 0; i < 4; i++) {
+                const GameState::Ghost& ghost = state.ghosts[i];
+                setBit(getPlane(planes, static_cast<Plane>(Blinky + i)), ghost.tile);
+
+                // The ghost mode planes are in the same order as spm::GhostMode
+                setBit(getPlane(planes, static_cast<Plane>(ScatteringGhosts + static_cast<int>(ghost.mode))), ghost.tile);
+            }
+        }
+
+        if (state.starTimer > 0) {
+            setBit(getPlane(planes, Star), Constants::StarSpawnTile);
+            std::memcpy(getPlane(planes, BonusFruits), bonusFruits_.data(), sizeof(bonusFruits_));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ObservationEncoder::encodeBytes(const GameState& state, std::uint8_t* planes) const {
+        std::array<std::uint32_t, getBitBufferSize()> bits;
+        encodeBits(state, bits.data());
+        expand(bits.data(), planes);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ObservationEncoder::expand(const std::uint32_t* bits, std::uint8_t* bytes) const {
+#ifdef SPM_OBSERVATION_ENCODER_SSE2
+        std::uint8_t* const end = bytes + getByteBufferSize();
+        const __m128i bitMask = _mm_set1_epi64x(0x8040201008040201);
+        const __m128i one = _mm_set1_epi8(1);
+#endif
+
+        for (int plane = 0; plane < PlaneCount; plane++) {
+            for (int row = 0; row < numRows_; row++, bytes += numColms_) {
+                std::uint32_t word = bits[plane * MazeLayout::MaxRows + row];
+
+#ifdef SPM_OBSERVATION_ENCODER_SSE2
+                // Rows are written 32 bytes at a time and the next rows overwrite the excess,
+                // the last rows are written one byte at a time to stay inside the buffer
+                if (end - bytes >= 32) {
+                    // Spread byte n of the word over bytes 8n to 8n+7, then keep one bit per byte
+                    __m128i spread = _mm_cvtsi32_si128(static_cast<int>(word));
+                    spread = _mm_unpacklo_epi8(spread, spread);
+                    spread = _mm_unpacklo_epi16(spread, spread);
+                    __m128i low = _mm_unpacklo_epi32(spread, spread);
+                    __m128i high = _mm_unpackhi_epi32(spread, spread);
+
+                    low = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(low, bitMask), bitMask), one);
+                    high = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(high, bitMask), bitMask), one);
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes), low);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes + 16), high);
+                    continue;
+                }
+#endif
+
+                for (int colm = 0; colm < numColms_; colm++)
+                    bytes[colm] = static_cast<std::uint8_t>((word >> colm) & 1);
+            }
+        }
+    }
+
+} // namespace spm
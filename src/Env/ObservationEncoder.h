@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_OBSERVATIONENCODER_H
+#define SUPERPACMAN_OBSERVATIONENCODER_H
+
+#include "GameState.h"
+#include "MazeLayout.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace spm {
+    /**
+     * @brief Encodes the state of a game as stacked planes over the maze
+     *
+     * Each plane marks the tiles that hold one kind of thing. In bit form
+     * a plane is MazeLayout::MaxRows 32-bit words, one per row, in which
+     * bit n is set if column n holds the thing. In byte form a plane is
+     * (number of rows * number of columns) bytes, row by row, each of
+     * which is 1 or 0.
+     *
+     * Encoding never allocates, the caller provides the buffers. The
+     * static parts of the maze are prepared once, on construction, so
+     * encoding a state only touches its items, doors and actors
+     */
+    class ObservationEncoder {
+    public:
+        /**
+         * @brief The planes of an observation, in the order they are written
+         */
+        enum Plane {
+            Walls,              //!< Solid walls
+            HiddenWalls,        //!< Walls only pacman can pass through
+            LockedDoors,        //!< Doors that are still locked
+            Fruits,             //!< Level fruits
+            PowerPellets,       //!< Power pellets
+            SuperPellets,       //!< Super pellets
+            Keys,               //!< Keys
+            PacMan,             //!< Pacman
+            Blinky,             //!< The red ghost
+            Pinky,              //!< The pink ghost
+            Inky,               //!< The cyan ghost
+            Clyde,              //!< The orange ghost
+            ScatteringGhosts,   //!< Ghosts in scatter mode
+            ChasingGhosts,      //!< Ghosts in chase mode
+            FrightenedGhosts,   //!< Ghosts that can be eaten
+            EatenGhosts,        //!< Ghosts returning to the ghost house
+            Star,               //!< The star
+            BonusFruits,        //!< The bonus fruits beside the star
+            PlaneCount          //!< Number of planes, keep last
+        };
+
+        /**
+         * @brief Constructor
+         * @param layout The maze the encoded games are played on
+         */
+        explicit ObservationEncoder(const MazeLayout& layout);
+
+        /**
+         * @brief Get the number of words a bit encoding is written to
+         * @return The size of the buffer spm::ObservationEncoder::encodeBits expects
+         */
+        static constexpr std::size_t getBitBufferSize() {
+            return PlaneCount * MazeLayout::MaxRows;
+        }
+
+        /**
+         * @brief Get the number of bytes a byte encoding is written to
+         * @return The size of the buffer spm::ObservationEncoder::encodeBytes expects
+         */
+        std::size_t getByteBufferSize() const;
+
+        /**
+         * @brief Encode a state as bit planes
+         * @param state The state to encode
+         * @param planes The buffer to write to (getBitBufferSize() words)
+         */
+        void encodeBits(const GameState& state, std::uint32_t* planes) const;
+
+        /**
+         * @brief Encode a state as byte planes
+         * @param state The state to encode
+         * @param planes The buffer to write to (getByteBufferSize() bytes)
+         */
+        void encodeBytes(const GameState& state, std::uint8_t* planes) const;
+
+        /**
+         * @brief Expand bit planes to byte planes
+         * @param bits Planes written by spm::ObservationEncoder::encodeBits
+         * @param bytes The buffer to write to (getByteBufferSize() bytes)
+         */
+        void expand(const std::uint32_t* bits, std::uint8_t* bytes) const;
+
+    private:
+        int numRows_;                                                   //!< The number of rows in the maze
+        int numColms_;                                                  //!< The number of columns in the maze
+        std::array<std::uint32_t, MazeLayout::MaxRows> walls_{};        //!< The walls plane
+        std::array<std::uint32_t, MazeLayout::MaxRows> hiddenWalls_{};  //!< The hidden walls plane
+        std::array<std::uint32_t, MazeLayout::MaxRows> bonusFruits_{}; //!< The tiles of the bonus fruits
+        std::array<ime::Index, MazeLayout::MaxDoors + 1> doorTiles_{};  //!< The tile of each door, by id
+    };
+}
+
+#endif
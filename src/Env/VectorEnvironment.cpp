@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "VectorEnvironment.h"
+#include <algorithm>
+#include <cassert>
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    VectorEnvironment::VectorEnvironment(std::shared_ptr<const MazeLayout> layout, std::size_t count) :
+        environments_(count, Environment(std::move(layout))),
+        rewards_(count, 0),
+        dones_(count, 0),
+        nextSeed_{0},
+        level_{1}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void VectorEnvironment::reset(std::uint64_t seed, int level) {
+        level_ = level;
+        nextSeed_ = seed;
+
+        for (auto& environment : environments_)
+            environment.reset(nextSeed_++, level_);
+
+        std::fill(rewards_.begin(), rewards_.end(), 0);
+        std::fill(dones_.begin(), dones_.end(), 0);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void VectorEnvironment::step(const Action* actions) {
+        assert(actions && "spm::VectorEnvironment requires one action per environment");
+
+        for (std::size_t i = 0; i < environments_.size(); i++) {
+            Environment::StepResult result = environments_[i].step(actions[i]);
+            rewards_[i] = result.reward;
+            dones_[i] = result.done;
+
+            if (result.done)
+                environments_[i].reset(nextSeed_++, level_);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t VectorEnvironment::getCount() const {
+        return environments_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const GameState& VectorEnvironment::getState(std::size_t index) const {
+        assert(index < environments_.size() && "Environment index out of range");
+        return environments_[index].getState();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const int* VectorEnvironment::getRewards() const {
+        return rewards_.data();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const std::uint8_t* VectorEnvironment::getDones() const {
+        return dones_.data();
+    }
+
+} // namespace spm
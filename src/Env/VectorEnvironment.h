@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_VECTORENVIRONMENT_H
+#define SUPERPACMAN_VECTORENVIRONMENT_H
+
+#include "Environment.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief A batch of environments that are stepped together
+     *
+     * The rewards and done flags of the batch are kept in contiguous arrays
+     * that a training loop can read directly after each step. Environments
+     * whose game ends are reset automatically with a fresh seed, so the
+     * batch can be stepped indefinitely
+     */
+    class VectorEnvironment {
+    public:
+        /**
+         * @brief Constructor
+         * @param layout The maze to play on
+         * @param count The number of environments in the batch
+         *
+         * The batch must be reset before it is stepped
+         */
+        VectorEnvironment(std::shared_ptr<const MazeLayout> layout, std::size_t count);
+
+        /**
+         * @brief Start a new game in every environment
+         * @param seed The seed of the first environment
+         * @param level The level to start on, in the range [1, 16]
+         *
+         * Environment i is seeded with @a seed + i. Environments that are
+         * reset automatically later on continue the sequence, therefore
+         * the whole batch is reproducible from @a seed
+         */
+        void reset(std::uint64_t seed, int level = 1);
+
+        /**
+         * @brief Advance every environment by one step
+         * @param actions One action per environment
+         *
+         * After the step, the done flag of an environment is set if its
+         * game ended during the step. Such an environment is reset and
+         * its state is the initial state of the next game
+         *
+         * @see getRewards, getDones
+         */
+        void step(const Action* actions);
+
+        /**
+         * @brief Get the number of environments in the batch
+         * @return The number of environments in the batch
+         */
+        std::size_t getCount() const;
+
+        /**
+         * @brief Get the state of an environment
+         * @param index The index of the environment
+         * @return The state of the environment
+         */
+        const GameState& getState(std::size_t index) const;
+
+        /**
+         * @brief Get the points scored by each environment in the last step
+         * @return One reward per environment
+         */
+        const int* getRewards() const;
+
+        /**
+         * @brief Get the done flag of each environment in the last step
+         * @return One flag per environment, 1 if its game ended, otherwise 0
+         */
+        const std::uint8_t* getDones() const;
+
+    private:
+        std::vector<Environment> environments_; //!< The environments in the batch
+        std::vector<int> rewards_;              //!< The reward of each environment in the last step
+        std::vector<std::uint8_t> dones_;       //!< The done flag of each environment in the last step
+        std::uint64_t nextSeed_;                //!< The seed of the next environment to be reset
+        int level_;                             //!< The level games start on
+    };
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include "Scenes/MainMenuScene.h"
 #include "Scenes/PauseMenuScene.h"
 #include "Common/Constants.h"
+#include <algorithm>
 
 namespace spm {
     ///////////////////////////////////////////////////////////////
@@ -42,7 +43,7 @@ namespace spm {
             // Make game window unresizable
             engine_.getWindow().setStyle(ime::WindowStyle::Close);
 
-            engine_.setPhysicsUpdateFrameRate(120);
+            engine_.setPhysicsUpdateFrameRate(Constants::SIMULATION_TICK_RATE);
 
             // Initialize data that should be accessible in all states
             auto scoreboard = std::make_shared<Scoreboard>("res/TextFiles/Highscores.txt");
@@ -50,16 +51,51 @@ namespace spm {
 
             engine_.getCache().addProperty({"SETTINGS_FILENAME", settingsFilename_});
             engine_.getCache().addProperty({"SCOREBOARD", scoreboard});
-            engine_.getCache().addProperty({"HIGH_SCORE", scoreboard->getTopScore().getValue()});
-            engine_.getCache().addProperty({"CURRENT_LEVEL", 1});
-            engine_.getCache().addProperty({"CURRENT_SCORE", 0});
-            engine_.getCache().addProperty({"PLAYER_LIVES", Constants::PacManLives});
-            engine_.getCache().addProperty({"NUM_EXTRA_LIVES_WON", 0});
-            engine_.getCache().addProperty({"MASTER_VOLUME", 100.0f});
             engine_.getCache().addProperty({"PLAYER_WON_GAME", false});
-            engine_.getCache().addProperty({"BONUS_STAGE", 3});
-            engine_.getCache().addProperty({"GHOSTS_FRIGHTENED_MODE_DURATION", ime::seconds(Constants::POWER_MODE_DURATION)});
-            engine_.getCache().addProperty({"PACMAN_SUPER_MODE_DURATION", ime::seconds(Constants::SUPER_MODE_DURATION)});
+
+            // Scenes change the session directly, the cache only catches up once per frame
+            session_.setHighScore(scoreboard->getSize() > 0 ? scoreboard->getTopScore().getValue() : 0);
+            session_.syncCache(engine_.getCache());
+            engine_.onFrameEnd([this] {
+                session_.syncCache(engine_.getCache());
+            });
+
+            // Gameplay tuning values, the tuning file may be edited while the game runs
+            services_.tuning = std::make_shared<TuningTable>();
+            if (engine_.getConfigs().hasPref("TUNING_FILE")) {
+                auto filename = engine_.getConfigs().getPref("TUNING_FILE").getValue<std::string>();
+                if (!filename.empty())
+                    services_.tuning->loadFromFile(filename);
+            }
+
+            // Shared by the gameplay scenes of a level, so that a rewound level keeps its history
+            int rewindBufferSize = Constants::REWIND_BUFFER_SIZE;
+            if (engine_.getConfigs().hasPref("REWIND_BUFFER_SIZE"))
+                rewindBufferSize = std::max(engine_.getConfigs().getPref("REWIND_BUFFER_SIZE").getValue<int>(), 0);
+
+            services_.rewindBuffer = std::make_shared<RewindBuffer>(rewindBufferSize * 1024u, Constants::SIMULATION_TICK_RATE); // One keyframe per second
+
+            // Gameplay events are only logged when a log file is configured
+            if (engine_.getConfigs().hasPref("TELEMETRY_LOG")) {
+                auto filename = engine_.getConfigs().getPref("TELEMETRY_LOG").getValue<std::string>();
+                if (!filename.empty())
+                    services_.telemetry = std::make_shared<TelemetryWriter>(filename, Constants::TELEMETRY_LOG_SIZE * 1024u, Constants::TELEMETRY_LOG_COUNT);
+            }
+
+            // The autopilot only steers pacman when it is given time to think
+            if (engine_.getConfigs().hasPref("AUTOPILOT_THINK_TIME"))
+                services_.autopilotThinkTime = std::max(engine_.getConfigs().getPref("AUTOPILOT_THINK_TIME").getValue<int>(), 0);
+
+            auto mazeLayout = std::make_shared<MazeLayout>();
+            if (services_.autopilotThinkTime > 0 && mazeLayout->loadFromFile("res/TextFiles/Mazes/GameplayMaze.txt"))
+                services_.autopilot = std::make_shared<Autopilot>(std::move(mazeLayout));
+
+            // Traces are only recorded to check the headless environment against the game
+            if (engine_.getConfigs().hasPref("SESSION_TRACE")) {
+                auto filename = engine_.getConfigs().getPref("SESSION_TRACE").getValue<std::string>();
+                if (!filename.empty())
+                    services_.trace = std::make_shared<SessionTrace>(filename);
+            }
 
             // If not found, player will be prompted for name in StartUpScene
             if (engine_.getConfigs().hasPref("PLAYER_NAME"))
@@ -67,8 +103,8 @@ namespace spm {
 
             // Since the user can go to these scenes on demand and as many times as they like,
             // we cache them to avoid instantiating new once's every time they are needed
-            engine_.cacheScene("MainMenuScene", std::make_unique<MainMenuScene>());
-            engine_.cacheScene("PauseMenuScene", std::make_unique<PauseMenuScene>());
+            engine_.cacheScene("MainMenuScene", std::make_unique<MainMenuScene>(session_, services_));
+            engine_.cacheScene("PauseMenuScene", std::make_unique<PauseMenuScene>(session_));
 
             // The scene the game will activate when executable is run
             engine_.pushScene(std::make_unique<StartUpScene>());
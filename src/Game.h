@@ -25,6 +25,8 @@
 #ifndef SUPERPACMAN_GAME_H
 #define SUPERPACMAN_GAME_H
 
+#include "Session/GameSession.h"
+#include "Session/GameServices.h"
 #include <IME/core/engine/Engine.h>
 
 namespace spm {
@@ -50,6 +52,8 @@ namespace spm {
 
     private:
         std::string settingsFilename_; //!< The name of the file with the engine settings
+        GameSession session_;          //!< The progress of the player, outlives the scenes that refer to it
+        GameServices services_;        //!< Objects shared by the gameplay scenes, outlive the scenes that refer to them
         ime::Engine engine_;           //!< Runs the main game loop
     };
 }
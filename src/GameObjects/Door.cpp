@@ -23,6 +23,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Door.h"
+#include "DoorKeys.h"
 
 namespace spm {
     ///////////////////////////////////////////////////////////////
@@ -30,25 +31,7 @@ namespace spm {
 
     ///////////////////////////////////////////////////////////////
     bool isValidKey(const Key& key, int doorId) {
-        switch (key.getId()) {
-            case 1: return doorId == 1 || doorId == 6;
-            case 2: return doorId == 3 || doorId == 7;
-            case 3: return doorId == 2 || doorId == 4;
-            case 4: return doorId == 5;
-            case 5: return doorId == 10 || doorId == 13 || doorId == 14;
-            case 6: return doorId == 11 || doorId == 17 || doorId == 18;
-            case 7: return doorId == 20 || doorId == 26;
-            case 8: return doorId == 15 || doorId == 21 || doorId == 24;
-            case 9: return doorId == 16 || doorId == 22 || doorId == 25;
-            case 10: return doorId == 23 || doorId == 27;
-            case 11: return doorId == 12 || doorId == 19 || doorId == 30;
-            case 12: return doorId == 29 || doorId == 34 || doorId == 36;
-            case 13: return doorId == 31 || doorId == 37;
-            case 14: return doorId == 28 || doorId == 33;
-            case 15: return doorId == 32 || doorId == 35;
-            default:
-                return false;
-        }
+        return isDoorKey(key.getId(), doorId);
     }
 
     ///////////////////////////////////////////////////////////////
@@ -82,6 +65,11 @@ namespace spm {
         orientation_ = orientation;
     }
 
+    ///////////////////////////////////////////////////////////////
+    int Door::getId() const {
+        return id_;
+    }
+
     ///////////////////////////////////////////////////////////////
     void Door::lock() {
         if (!isLocked_) {
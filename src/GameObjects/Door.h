@@ -69,6 +69,14 @@ namespace spm {
          */
         void lock();
 
+        /**
+         * @brief Get the doors identification code
+         * @return The doors identification code
+         *
+         * Doors are numbered from 1 in the order in which they are created
+         */
+        int getId() const;
+
         /**
          * @brief unlock the door with a key
          * @param key Key to unlock door with
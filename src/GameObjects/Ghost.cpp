@@ -24,7 +24,6 @@
 
 #include "Ghost.h"
 #include "Animations/GhostAnimations.h"
-#include "AI/ghost/ScatterState.h"
 #include "Utils/Utils.h"
 #include "Common/ObjectReferenceKeeper.h"
 #include <memory>
@@ -34,6 +33,7 @@ namespace spm {
     ///////////////////////////////////////////////////////////////
     Ghost::Ghost(ime::Scene& scene, Colour colour) :
         ime::GridObject(scene),
+        stateMachine_{*this},
         isLockedInHouse_{false},
         isFlat_{false}
     {
@@ -58,24 +58,9 @@ namespace spm {
         return "Ghost";
     }
 
-    ///////////////////////////////////////////////////////////////
-    void Ghost::setState(IActorState::Ptr state) {
-        if (state_)
-            state_->onExit();
-
-        if (state) {
-            state_ = std::move(state);
-            auto* ghostState = dynamic_cast<GhostState*>(state_.get());
-            assert(ghostState && "Invalid ghost state");
-            ghostState->setTarget(this);
-            state_->onEntry();
-        } else
-            clearState();
-    }
-
     ///////////////////////////////////////////////////////////////
     void Ghost::clearState() {
-        state_ = nullptr;
+        stateMachine_.clear();
         ime::GameObject::setState(static_cast<int>(State::None));
     }
 
@@ -128,16 +113,21 @@ namespace spm {
         return isFlat_;
     }
 
+    ///////////////////////////////////////////////////////////////
+    void Ghost::setTimeDomains(const TimeDomain& movement, const TimeDomain& animation) {
+        movementDomain_.setDomain(movement);
+        animationDomain_.setDomain(animation);
+    }
+
     ///////////////////////////////////////////////////////////////
     void Ghost::update(ime::Time deltaTime) {
-        if (state_)
-            state_->update(deltaTime);
+        utils::updateTimescale(*this, movementDomain_, animationDomain_);
+        stateMachine_.update(deltaTime);
     }
 
     ///////////////////////////////////////////////////////////////
     void Ghost::handleEvent(GameEvent event, const ime::PropertyContainer &args) {
-        if (state_)
-            state_->handleEvent(event, args);
+        stateMachine_.handleEvent(event);
     }
 
     ///////////////////////////////////////////////////////////////
@@ -25,10 +25,11 @@
 #ifndef SUPERPACMAN_GHOST_H
 #define SUPERPACMAN_GHOST_H
 
-#include "AI/IActorState.h"
+#include "AI/ghost/GhostStateMachine.h"
 #include "Common/Events.h"
+#include "Common/TimeDomain.h"
 #include <IME/core/object/GridObject.h>
-#include <memory>
+#include <IME/common/PropertyContainer.h>
 
 namespace spm {
     /**
@@ -72,19 +73,20 @@ namespace spm {
 
         /**
          * @brief Change the state
-         * @param state The new state
+         * @tparam TState The new state
+         * @param args The arguments of the constructor of @a TState
          *
-         * Any active state will be destroyed. Pass @a state as nullptr to
-         * remove the current state
+         * The active state will be exited and destroyed before @a TState
+         * is entered
          */
-        void setState(IActorState::Ptr state);
+        template <typename TState, typename... Args>
+        void setState(Args&&... args);
 
         /**
          * @brief Destroy the current state
          *
-         * Similarly to passing nullptr as an argument to spm::Ghost::State,
-         * this function removes the current state. However it does not call
-         * the onExit function on the state before destroying it.
+         * This function removes the current state without calling the
+         * onExit function on the state before destroying it.
          */
         void clearState();
 
@@ -137,6 +139,16 @@ namespace spm {
          */
         bool isFlat() const;
 
+        /**
+         * @brief Set the time domains the ghost belongs to
+         * @param movement The domain of the ghosts grid mover
+         * @param animation The domain of the ghosts animator
+         *
+         * The domains must be set again when the ghost is given a new
+         * grid mover. They must outlive the ghost
+         */
+        void setTimeDomains(const TimeDomain& movement, const TimeDomain& animation);
+
         /**
          * @brief Update the ghost
          * @param deltaTime Time passed since last update
@@ -162,10 +174,18 @@ namespace spm {
         void initAnimations();
 
     private:
-        IActorState::Ptr state_;   //!< The current state of the ghost
-        bool isLockedInHouse_;     //!< A flag indicating whether or not the ghost is locked in the ghost pen
-        bool isFlat_;              //!< A flag indicating whether or not the ghost is flat
+        GhostStateMachine stateMachine_; //!< Ghost AI
+        bool isLockedInHouse_;           //!< A flag indicating whether or not the ghost is locked in the ghost pen
+        bool isFlat_;                    //!< A flag indicating whether or not the ghost is flat
+        TimeDomainTracker movementDomain_;  //!< Tracks the timescale of the ghosts grid mover
+        TimeDomainTracker animationDomain_; //!< Tracks the timescale of the ghosts animator
     };
+
+    ///////////////////////////////////////////////////////////////
+    template <typename TState, typename... Args>
+    void Ghost::setState(Args&&... args) {
+        stateMachine_.transitionTo<TState>(std::forward<Args>(args)...);
+    }
 }
 
 #endif
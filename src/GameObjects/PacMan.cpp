@@ -32,6 +32,7 @@ namespace spm {
     ///////////////////////////////////////////////////////////////
     PacMan::PacMan(ime::Scene& scene) :
         ime::GridObject(scene),
+        stateMachine_{*this},
         livesCount_{Constants::PacManLives}
     {
         setTag("pacman");
@@ -75,9 +76,11 @@ namespace spm {
 
     ///////////////////////////////////////////////////////////////
     void PacMan::setState(PacMan::State state) {
-        ime::GameObject::setState(static_cast<int>(state));
-        switchAnimation(getDirection() * -1);
-        switchAnimation(getDirection());
+        switch (state) {
+            case State::Normal: stateMachine_.transitionTo<NormalState>();  break;
+            case State::Super:  stateMachine_.transitionTo<SuperState>();   break;
+            case State::Dying:  stateMachine_.transitionTo<DyingState>();   break;
+        }
     }
 
     ///////////////////////////////////////////////////////////////
@@ -100,12 +103,20 @@ namespace spm {
         return getSprite().getAnimator().getActiveAnimation()->getName().find("Flashing") != std::string::npos;
     }
 
+    ///////////////////////////////////////////////////////////////
+    void PacMan::setTimeDomains(const TimeDomain& movement, const TimeDomain& animation) {
+        movementDomain_.setDomain(movement);
+        animationDomain_.setDomain(animation);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void PacMan::update(ime::Time deltaTime) {
+        utils::updateTimescale(*this, movementDomain_, animationDomain_);
+    }
+
     ///////////////////////////////////////////////////////////////
     void PacMan::handleEvent(GameEvent event, const ime::PropertyContainer &args) {
-        if (event == GameEvent::SuperModeBegin)
-            setState(State::Super);
-        else if (event == GameEvent::SuperModeEnd)
-            setState(State::Normal);
+        stateMachine_.handleEvent(event);
     }
 
     ///////////////////////////////////////////////////////////////
@@ -25,8 +25,10 @@
 #ifndef SUPERPACMAN_PACMAN_H
 #define SUPERPACMAN_PACMAN_H
 
-#include "AI/IActorState.h"
+#include "AI/pacman/PacManStateMachine.h"
+#include "Common/TimeDomain.h"
 #include <IME/core/object/GridObject.h>
+#include <IME/common/PropertyContainer.h>
 
 namespace spm {
     /**
@@ -100,6 +102,22 @@ namespace spm {
          */
         bool isFlashing() const;
 
+        /**
+         * @brief Set the time domains pacman belongs to
+         * @param movement The domain of pacmans grid mover
+         * @param animation The domain of pacmans animator
+         *
+         * The domains must be set again when pacman is given a new grid
+         * mover. They must outlive pacman
+         */
+        void setTimeDomains(const TimeDomain& movement, const TimeDomain& animation);
+
+        /**
+         * @brief Update pacman
+         * @param deltaTime Time passed since last update
+         */
+        void update(ime::Time deltaTime) override;
+
         /**
          * @brief Handle a game event
          * @param event The event to be handled
@@ -125,7 +143,10 @@ namespace spm {
         void initAnimations();
 
     private:
-        int livesCount_;             //!< The actors current number of lives
+        PacManStateMachine stateMachine_; //!< Switches between the Normal, Super and Dying states
+        int livesCount_;                  //!< The actors current number of lives
+        TimeDomainTracker movementDomain_;  //!< Tracks the timescale of pacmans grid mover
+        TimeDomainTracker animationDomain_; //!< Tracks the timescale of pacmans animator
     };
 }
 
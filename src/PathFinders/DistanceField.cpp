@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "DistanceField.h"
+#include <IME/core/object/GridObject.h>
+#include <algorithm>
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    DistanceField::DistanceField(ime::Grid2D& grid, Obstacles obstacles) :
+        grid_{grid},
+        obstacles_{obstacles},
+        numRows_{static_cast<int>(grid.getSizeInTiles().y)},
+        numColms_{static_cast<int>(grid.getSizeInTiles().x)},
+        source_{-1, -1},
+        isComputed_{false},
+        blocked_(numRows_ * numColms_, false),
+        distances_(numRows_ * numColms_, Unreachable),
+        frontier_(numRows_ * numColms_, 0)
+    {
+        refreshObstacles();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void DistanceField::refreshObstacles() {
+        std::fill(blocked_.begin(), blocked_.end(), false);
+
+        grid_.forEachChild([this](ime::GridObject* child) {
+            if (!child->isObstacle())
+                return;
+
+            if (obstacles_ == Obstacles::Walls && child->getClassName() == "Door")
+                return;
+
+            const ime::Index& index = grid_.getTileOccupiedByChild(child).getIndex();
+            blocked_[toCell(index.row, index.colm)] = true;
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void DistanceField::compute(const ime::Index& source) {
+        source_ = source;
+        isComputed_ = true;
+        std::fill(distances_.begin(), distances_.end(), Unreachable);
+
+        if (source.row < 0 || source.row >= numRows_ || source.colm < 0 || source.colm >= numColms_)
+            return;
+
+        int head = 0, tail = 0;
+        int sourceCell = toCell(source.row, source.colm);
+        distances_[sourceCell] = 0;
+        frontier_[tail++] = sourceCell;
+
+        while (head < tail) {
+            int cell = frontier_[head++];
+            int row = cell / numColms_;
+            int colm = cell % numColms_;
+
+            const int neighbours[] = {
+                row > 0 ? toCell(row - 1, colm) : -1,
+                row < numRows_ - 1 ? toCell(row + 1, colm) : -1,
+                toCell(row, colm == 0 ? numColms_ - 1 : colm - 1),
+                toCell(row, colm == numColms_ - 1 ? 0 : colm + 1)
+            };
+
+            for (int neighbour : neighbours) {
+                if (neighbour != -1 && !blocked_[neighbour] && distances_[neighbour] == Unreachable) {
+                    distances_[neighbour] = distances_[cell] + 1;
+                    frontier_[tail++] = neighbour;
+                }
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void DistanceField::recompute() {
+        if (isComputed_)
+            compute(source_);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool DistanceField::isComputed() const {
+        return isComputed_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const ime::Index& DistanceField::getSource() const {
+        return source_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int DistanceField::getDistance(const ime::Index& index) const {
+        if (index.row < 0 || index.row >= numRows_ || index.colm < 0 || index.colm >= numColms_)
+            return Unreachable;
+
+        return distances_[toCell(index.row, index.colm)];
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int DistanceField::toCell(int row, int colm) const {
+        return row * numColms_ + colm;
+    }
+
+} // namespace spm
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_DISTANCEFIELD_H
+#define SUPERPACMAN_DISTANCEFIELD_H
+
+#include <IME/core/grid/Grid2D.h>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Breadth-first distance field over the maze
+     *
+     * The field stores the number of steps from every tile in the grid to
+     * a single source tile. It is computed once per source change and can
+     * then be shared by any number of readers, each of which pays O(1) per
+     * query. For example, a field computed from pacman's tile whenever he
+     * enters a new tile lets all four ghosts follow the shortest path to
+     * him for the cost of a single search
+     */
+    class DistanceField {
+    public:
+        static constexpr int Unreachable = -1; //!< Distance of a tile that cannot reach the source
+
+        /**
+         * @brief Objects that block the search
+         */
+        enum class Obstacles {
+            Walls,         //!< Only walls block the search (Used for eaten ghosts, which pass through doors)
+            WallsAndDoors  //!< Walls and locked doors block the search
+        };
+
+        /**
+         * @brief Constructor
+         * @param grid The grid to compute the field over
+         * @param obstacles The objects that block the search
+         *
+         * The obstacles are recorded on construction, therefore @a grid
+         * must be populated before the field is created
+         *
+         * @see refreshObstacles
+         */
+        DistanceField(ime::Grid2D& grid, Obstacles obstacles);
+
+        /**
+         * @brief Record the tiles that are blocked by an obstacle
+         *
+         * This function must be called when an obstacle is added to or
+         * removed from the grid (e.g. when a door is opened), otherwise
+         * the field is computed against the old obstacles
+         */
+        void refreshObstacles();
+
+        /**
+         * @brief Compute the distance from every tile to a source tile
+         * @param source The tile to compute the distances to
+         *
+         * The search wraps around the left and right edges of the grid
+         * in order to account for the tunnel
+         */
+        void compute(const ime::Index& source);
+
+        /**
+         * @brief Recompute the field from its current source
+         *
+         * This function has no effect if the field has never been computed
+         */
+        void recompute();
+
+        /**
+         * @brief Check if the field has been computed
+         * @return True if computed, otherwise false
+         */
+        bool isComputed() const;
+
+        /**
+         * @brief Get the tile the field was computed from
+         * @return The source tile
+         */
+        const ime::Index& getSource() const;
+
+        /**
+         * @brief Get the distance from a tile to the source tile
+         * @param index The index of the tile
+         * @return The number of steps to the source or spm::DistanceField::Unreachable
+         *         if @a index is blocked, outside the grid or cannot reach the source
+         */
+        int getDistance(const ime::Index& index) const;
+
+    private:
+        /**
+         * @brief Convert a tile index to a position in the flat buffers
+         */
+        int toCell(int row, int colm) const;
+
+    private:
+        ime::Grid2D& grid_;          //!< The grid the field is computed over
+        Obstacles obstacles_;        //!< The objects that block the search
+        int numRows_;                //!< The number of rows in the grid
+        int numColms_;               //!< The number of columns in the grid
+        ime::Index source_;          //!< The tile the field was last computed from
+        bool isComputed_;            //!< A flag indicating whether or not the field has been computed
+        std::vector<bool> blocked_;  //!< Tiles that cannot be entered
+        std::vector<int> distances_; //!< Distance from each tile to the source
+        std::vector<int> frontier_;  //!< Search queue, preallocated to avoid allocating per search
+    };
+}
+
+#endif
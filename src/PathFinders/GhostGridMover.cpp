@@ -27,7 +27,6 @@
 #include "Common/ObjectReferenceKeeper.h"
 #include <cassert>
 #include <algorithm>
-#include <random>
 #include <limits>
 #include <cmath>
 
@@ -47,9 +46,11 @@ namespace spm {
     }
 
     ///////////////////////////////////////////////////////////////
-    GhostGridMover::GhostGridMover(ime::Grid2D& grid, Ghost* ghost) :
+    GhostGridMover::GhostGridMover(ime::Grid2D& grid, Ghost* ghost, Random& random, const LevelTuning& tuning) :
         ime::GridMover(grid, ghost),
         ghost_{ghost},
+        random_{random},
+        tuning_{tuning},
         movementStarted_{false},
         forceDirReversal_{false},
         moveStrategy_{Strategy::Random},
@@ -86,6 +87,8 @@ namespace spm {
                 requestMove(getMinDistanceDirection(Constants::BlinkySpawnTile));
             else if (moveStrategy_ == Strategy::Random)
                 requestMove(getRandomDirection());
+            else if (const DistanceField* field = findDistanceField(targetTile_); field)
+                requestMove(getShortestPathDirection(*field));
             else
                 requestMove(getMinDistanceDirection(targetTile_));
         }
@@ -93,6 +96,11 @@ namespace spm {
         possibleDirections_.clear();
     }
 
+    ///////////////////////////////////////////////////////////////
+    const LevelTuning& GhostGridMover::getLevelTuning() const {
+        return tuning_;
+    }
+
     ///////////////////////////////////////////////////////////////
     void GhostGridMover::setMoveStrategy(GhostGridMover::Strategy strategy) {
         moveStrategy_ = strategy;
@@ -103,6 +111,11 @@ namespace spm {
         targetTile_ = index;
     }
 
+    ///////////////////////////////////////////////////////////////
+    void GhostGridMover::addDistanceField(const DistanceField& field) {
+        distanceFields_.push_back(&field);
+    }
+
     ///////////////////////////////////////////////////////////////
     void GhostGridMover::startMovement() {
         if (!movementStarted_) {
@@ -135,9 +148,7 @@ namespace spm {
 
     ///////////////////////////////////////////////////////////////
     ime::Direction GhostGridMover::getRandomDirection() {
-        auto static randomEngine = std::default_random_engine{std::random_device{}()};
-        std::shuffle(possibleDirections_.begin(), possibleDirections_.end(), randomEngine);
-        return possibleDirections_.front();
+        return possibleDirections_[random_.nextInt(0, static_cast<int>(possibleDirections_.size()) - 1)];
     }
 
     ///////////////////////////////////////////////////////////////
@@ -161,6 +172,38 @@ namespace spm {
         return index == -1 ? possibleDirections_.front() : possibleDirections_[index];
     }
 
+    ///////////////////////////////////////////////////////////////
+    ime::Direction GhostGridMover::getShortestPathDirection(const DistanceField& field) const {
+        int minDistance = DistanceField::Unreachable;
+        int index = -1;
+
+        for (int i = 0; i < possibleDirections_.size(); i++) {
+            const ime::Direction& dir = possibleDirections_[i];
+            int distance = field.getDistance(ime::Index{getCurrentTileIndex().row + dir.y, getCurrentTileIndex().colm + dir.x});
+
+            if (distance != DistanceField::Unreachable && (index == -1 || distance < minDistance)) {
+                minDistance = distance;
+                index = i;
+            }
+        }
+
+        // The source cannot be reached from any adjacent tile (e.g. the ghost is beyond a locked door)
+        if (index == -1)
+            return getMinDistanceDirection(field.getSource());
+
+        return possibleDirections_[index];
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const DistanceField* GhostGridMover::findDistanceField(const ime::Index& targetTile) const {
+        for (const DistanceField* field : distanceFields_) {
+            if (field->isComputed() && field->getSource() == targetTile)
+                return field;
+        }
+
+        return nullptr;
+    }
+
     ///////////////////////////////////////////////////////////////
     bool GhostGridMover::isAllowedToBeInGhostHouse() {
         return ghost_->isLockedInGhostHouse() || ghost_->getState() == Ghost::State::Eaten ||
@@ -26,6 +26,9 @@
 #define SUPERPACMAN_GHOSTGRIDMOVER_H
 
 #include "GameObjects/Ghost.h"
+#include "DistanceField.h"
+#include "Common/Random.h"
+#include "Common/DifficultyTable.h"
 #include <IME/core/physics/grid/GridMover.h>
 #include <vector>
 
@@ -47,8 +50,20 @@ namespace spm {
          * @brief Constructor
          * @param grid The grid the target is in
          * @param ghost Ghost to be moved in the tilemap
+         * @param random Generates the directions of a randomly moving ghost
+         * @param tuning The tuning values of the level the ghost is in
+         *
+         * The random number generator is shared with the gameplay session,
+         * so that random movement can be saved and replayed. It and the
+         * tuning values must outlive the grid mover
          */
-        GhostGridMover(ime::Grid2D& grid, Ghost* ghost);
+        GhostGridMover(ime::Grid2D& grid, Ghost* ghost, Random& random, const LevelTuning& tuning);
+
+        /**
+         * @brief Get the tuning values of the level the ghost is in
+         * @return The tuning values of the level the ghost is in
+         */
+        const LevelTuning& getLevelTuning() const;
 
         /**
          * @brief Set the PathFinders strategy
@@ -66,6 +81,19 @@ namespace spm {
          */
         void setTargetTile(ime::Index index);
 
+        /**
+         * @brief Share a distance field with the ghost
+         * @param field The field to be shared
+         *
+         * When the ghost is targeting a tile that is the source of a shared
+         * field, it follows the shortest path in the field instead of
+         * steering greedily towards the tile. The field must outlive the
+         * grid mover
+         *
+         * By default, no field is shared
+         */
+        void addDistanceField(const DistanceField& field);
+
         /**
          * @brief Start the PathFinders
          */
@@ -109,6 +137,24 @@ namespace spm {
          */
         ime::Direction getMinDistanceDirection(const ime::Index& targetTile) const;
 
+        /**
+         * @brief Get a direction with minimal distance to the source of a distance field
+         * @param field The distance field to follow
+         * @return The direction to go in
+         * @note This function must be called after forbidden directions have
+         * been filtered out from the possible directions, otherwise it may
+         * return an invalid direction
+         */
+        ime::Direction getShortestPathDirection(const DistanceField& field) const;
+
+        /**
+         * @brief Get the shared distance field whose source is a given tile
+         * @param targetTile The tile to get the distance field for
+         * @return The distance field or a nullptr if no shared field is
+         *         computed from @a targetTile
+         */
+        const DistanceField* findDistanceField(const ime::Index& targetTile) const;
+
         /**
          * @brief Check if the ghost is allowed to be in the ghost house
          * @return True if is allowed otherwise false
@@ -120,11 +166,14 @@ namespace spm {
 
     private:
         Ghost* ghost_;                                   //!< The target ghost
+        Random& random_;                                 //!< Session random number generator
+        const LevelTuning& tuning_;                      //!< Tuning values of the level
         bool movementStarted_;                           //!< Flags if PathFinders has been initiated or not
         bool forceDirReversal_;                          //!< A flag indicating whether or not to force the ghost to reverse directions
         Strategy moveStrategy_;                          //!< The current PathFinders strategy of the ghost
         ime::Index targetTile_;                          //!< The target tile to move to when move strategy is target
         std::vector<ime::Direction> possibleDirections_; //!< Stores directions to be attempted by randomly moving ghost
+        std::vector<const DistanceField*> distanceFields_; //!< Distance fields shared with other ghosts
     };
 }
 
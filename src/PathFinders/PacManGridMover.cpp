@@ -93,6 +93,20 @@ namespace spm {
         });
     }
 
+    ///////////////////////////////////////////////////////////////
+    void PacManGridMover::steer(ime::Direction direction) {
+        auto* pacman = static_cast<PacMan*>(getTarget());
+        if (direction == ime::Unknown || pacman->getState() == PacMan::State::Dying)
+            return;
+
+        auto [isBlocked, obstacle] = isBlockedInDirection(direction);
+        if (!isTargetMoving() && (!isBlocked || (pacman->getState() == PacMan::State::Super && obstacle && obstacle->getClassName() == "Door"))) {
+            pendingDirection_ = ime::Unknown;
+            requestMove(direction);
+        } else
+            pendingDirection_ = direction;
+    }
+
     ///////////////////////////////////////////////////////////////
     PacManGridMover::~PacManGridMover() {
         if (getTarget())
@@ -49,6 +49,15 @@ namespace spm {
          */
         void init();
 
+        /**
+         * @brief Turn pacman as if the player pressed a direction key
+         * @param direction The direction pacman should go in
+         *
+         * If pacman cannot turn right away, he turns as soon as the way
+         * is clear, unless he is steered again before then
+         */
+        void steer(ime::Direction direction);
+
         /**
          * @brief Destructor
          */
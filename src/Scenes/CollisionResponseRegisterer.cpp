@@ -28,7 +28,6 @@
 #include "Common/Constants.h"
 #include "LevelStartScene.h"
 #include "Utils/Utils.h"
-#include "AI/ghost/EatenState.h"
 #include <IME/core/engine/Engine.h>
 #include <cassert>
 
@@ -94,26 +93,37 @@ namespace spm {
             return;
 
         fruit->setActive(false);
+        game_.markItemEaten(fruit);
         game_.updateScore(Constants::Points::FRUIT * game_.currentLevel_);
         game_.numFruitsEaten_++;
-        game_.getAudio().play(ime::audio::Type::Sfx, "WakkaWakka.wav");
+        game_.sfx_.play(SoundEffect::FruitEaten);
     }
 
     ///////////////////////////////////////////////////////////////
     void CollisionResponseRegisterer::resolveKeyCollision(ime::GridObject *key) {
         if (key->getClassName() == "Key") {
             // Attempt to unlock a door with the collected key
-            game_.getGameObjects().forEachInGroup("Door",[key](ime::GameObject* gameObject) {
+            int numDoorsUnlocked = 0;
+            game_.getGameObjects().forEachInGroup("Door",[key, &numDoorsUnlocked](ime::GameObject* gameObject) {
                 auto* door = static_cast<Door*>(gameObject);
+                bool wasLocked = door->isLocked();
                 door->unlock(*static_cast<Key*>(key));
 
-                if (!door->isLocked())
+                if (!door->isLocked()) {
                     door->setActive(false);
+
+                    if (wasLocked)
+                        numDoorsUnlocked++;
+                }
             });
 
+            game_.recordEvent(TelemetryEventType::KeyCollected, key, 0, numDoorsUnlocked);
             key->setActive(false);
+            game_.markItemEaten(key);
+            game_.markDoorsChanged();
+            game_.refreshDistanceFields();
             game_.updateScore(Constants::Points::KEY);
-            game_.getAudio().play(ime::audio::Type::Sfx, "keyEaten.wav");
+            game_.sfx_.play(SoundEffect::KeyEaten);
         }
     }
 
@@ -121,35 +131,27 @@ namespace spm {
     void CollisionResponseRegisterer::resolvePowerPelletCollision(ime::GridObject *pellet) {
         if (pellet->getClassName() == "Pellet" && pellet->getTag() == "power") {
             pellet->setActive(false);
+            game_.markItemEaten(pellet);
 
             game_.pauseGhostAITimer();
             game_.updateScore(Constants::Points::POWER_PELLET);
 
             if (!game_.isBonusStage_) {
-                game_.mainAudio_->stop();
-                game_.mainAudio_->setSource("ghostsTurnedBlue.wav");
-                game_.mainAudio_->play();
+                game_.music_.switchTo(MusicTrack::Frightened);
 
                 game_.configureTimer(game_.powerModeTimer_, game_.getFrightenedModeDuration(), [this] {
-                    game_.pointsMultiplier_ = 1;
-
-                    if (!game_.superModeTimer_.isRunning())
-                        game_.resumeGhostAITimer();
-
-                    game_.emit(GameEvent::FrightenedModeEnd);
-
-                    game_.mainAudio_->stop();
-                    game_.mainAudio_->setSource("wieu_wieu_slow.ogg");
-                    game_.mainAudio_->play();
+                    game_.endPowerMode();
                 });
+
+                game_.recordEvent(TelemetryEventType::PowerModeBegin, pellet, 0, game_.getFrightenedModeDuration().asMilliseconds());
             }
 
             // Extend super mode duration by power mode duration
-            if (game_.superModeTimer_.isRunning())
-                game_.superModeTimer_.setInterval(game_.superModeTimer_.getRemainingDuration() + game_.getFrightenedModeDuration());
+            if (game_.aiTime_.getTimers().isRunning(game_.superModeTimer_))
+                game_.aiTime_.getTimers().extend(game_.superModeTimer_, game_.getFrightenedModeDuration());
 
             game_.numPelletsEaten_++;
-            game_.getAudio().play(ime::audio::Type::Sfx, "powerPelletEaten.wav");
+            game_.sfx_.play(SoundEffect::PowerPelletEaten);
             game_.emit(GameEvent::FrightenedModeBegin);
         }
     }
@@ -158,19 +160,21 @@ namespace spm {
     void CollisionResponseRegisterer::resolveSuperPelletCollision(ime::GridObject *pellet) {
         if (pellet->getClassName() == "Pellet" && pellet->getTag() == "super") {
             pellet->setActive(false);
+            game_.markItemEaten(pellet);
 
             game_.pauseGhostAITimer();
             game_.updateScore(Constants::Points::SUPER_PELLET);
 
             if (!game_.isBonusStage_) {
                 game_.configureTimer(game_.superModeTimer_, game_.getSuperModeDuration(), [this] {
-                    game_.emit(GameEvent::SuperModeEnd);
-                    game_.resumeGhostAITimer();
+                    game_.endSuperMode();
                 });
+
+                game_.recordEvent(TelemetryEventType::SuperModeBegin, pellet, 0, game_.getSuperModeDuration().asMilliseconds());
             }
 
             game_.numPelletsEaten_++;
-            game_.getAudio().play(ime::audio::Type::Sfx, "superPelletEaten.wav");
+            game_.sfx_.play(SoundEffect::SuperPelletEaten);
             game_.emit(GameEvent::SuperModeBegin);
         }
     }
@@ -184,15 +188,16 @@ namespace spm {
 
             game_.despawnStar();
             game_.getAudio().stopAll();
+            game_.sfx_.stopAll();
+            game_.music_.stop();
             game_.stopAllTimers();
             game_.getInput().setAllInputEnable(false);
 
             auto pac = static_cast<PacMan*>(pacman);
             pac->setState(PacMan::State::Dying);
-            pac->getSprite().getAnimator().startAnimation("dying");
             pac->setLivesCount(pac->getLivesCount() - 1);
-            game_.getCache().setValue("PLAYER_LIVES", pac->getLivesCount());
-            game_.view_->removeLife();
+            game_.recordEvent(TelemetryEventType::PacManDied, pacman, ghost ? GameplayScene::getGhostIndex(ghost) : 0, pac->getLivesCount());
+            game_.session_.setLives(pac->getLivesCount());
 
             game_.getGameObjects().forEachInGroup("Ghost", [](ime::GameObject* ghost) {
                 ghost->getSprite().setVisible(false);
@@ -200,40 +205,36 @@ namespace spm {
             });
 
             auto deathAnimDuration = pacman->getSprite().getAnimator().getAnimation("dying")->getDuration();
-            game_.getTimer().setTimeout(deathAnimDuration + ime::milliseconds(400), [this, pacman] {
+            game_.gameplayTime_.getTimers().schedule(deathAnimDuration + ime::milliseconds(400), [this, pacman] {
                 if (static_cast<PacMan*>(pacman)->getLivesCount() <= 0) {
                     game_.getGameObjects().remove(pacman);
                     game_.endGameplay();
                 } else
-                    game_.getEngine().pushScene(std::make_unique<LevelStartScene>());
+                    game_.getEngine().pushScene(std::make_unique<LevelStartScene>(game_.session_));
             });
 
-            game_.getAudio().play(ime::audio::Type::Sfx, "pacmanDying.wav");
+            game_.sfx_.play(SoundEffect::PacManDying);
         }
     }
 
     ///////////////////////////////////////////////////////////////
     void CollisionResponseRegisterer::resolveGhostCollision(ime::GridObject *ghost, ime::GridObject *otherGameObject) {
         if (ghost->getClassName() == "Ghost" && static_cast<Ghost*>(ghost)->getState() == Ghost::State::Frightened) {
-            game_.powerModeTimer_.pause();
-
-            if (game_.superModeTimer_.isRunning())
-                game_.superModeTimer_.pause();
-
             setMovementFreeze(true);
             game_.updateScore(Constants::Points::GHOST * game_.pointsMultiplier_);
+            game_.recordEvent(TelemetryEventType::GhostEaten, ghost, GameplayScene::getGhostIndex(ghost), Constants::Points::GHOST * game_.pointsMultiplier_);
             replaceWithScoreTexture(ghost, otherGameObject);
             game_.updatePointsMultiplier();
 
-            game_.getTimer().setTimeout(ime::seconds(1), [=] {
-                game_.mainAudio_->play();
+            game_.gameplayTime_.getTimers().schedule(ime::seconds(1), [=] {
+                game_.music_.resume();
                 setMovementFreeze(false);
                 otherGameObject->getSprite().setVisible(true);
 
-                if (game_.superModeTimer_.isPaused())
-                    game_.superModeTimer_.resume();
-
-                static_cast<Ghost*>(ghost)->setState(std::make_unique<EatenState>(game_.isChaseMode_ ? Ghost::State::Chase : Ghost::State::Scatter));
+                if (game_.isChaseMode_)
+                    static_cast<Ghost*>(ghost)->setState<EatenState>(EatenState::NextState::Chase);
+                else
+                    static_cast<Ghost*>(ghost)->setState<EatenState>(EatenState::NextState::Scatter);
 
                 bool isSomeGhostsBlue = false;
                 game_.getGameObjects().forEachInGroup("Ghost", [&isSomeGhostsBlue](ime::GameObject* ghost) {
@@ -241,34 +242,19 @@ namespace spm {
                         isSomeGhostsBlue = true;
                 });
 
-                if (isSomeGhostsBlue)
-                    game_.powerModeTimer_.resume();
-                else
-                    game_.powerModeTimer_.forceTimeout();
+                if (!isSomeGhostsBlue)
+                    game_.aiTime_.getTimers().forceTimeout(game_.powerModeTimer_);
             });
 
-            game_.mainAudio_->pause();
-            game_.getAudio().play(ime::audio::Type::Sfx, "ghostEaten.wav");
+            game_.music_.pause();
+            game_.sfx_.play(SoundEffect::GhostEaten);
         }
     }
 
     ///////////////////////////////////////////////////////////////
     void CollisionResponseRegisterer::resolveStarCollision(ime::GridObject *star, ime::GridObject *otherGameObject) {
         if (star->getClassName() == "Star") {
-            game_.starTimer_.stop();
-
-            if (game_.ghostAITimer_.isRunning())
-                game_.ghostAITimer_.pause();
-
-            if (game_.powerModeTimer_.isRunning())
-                game_.powerModeTimer_.pause();
-
-            if (game_.superModeTimer_.isRunning())
-                game_.superModeTimer_.pause();
-
-            if (game_.bonusStageTimer_.isRunning())
-                game_.bonusStageTimer_.pause();
-
+            game_.aiTime_.getTimers().cancel(game_.starTimer_);
             setMovementFreeze(true);
             star->getSprite().getAnimator().stop();
 
@@ -290,43 +276,29 @@ namespace spm {
 
                 star->resetSpriteOrigin();
                 freezeDuration = ime::seconds(3.3);
-                game_.getAudio().play(ime::audio::Type::Sfx, "bonusFruitMatch.wav");
+                game_.sfx_.play(SoundEffect::BonusFruitMatch);
             } else {
                 game_.updateScore(Constants::Points::GHOST * game_.pointsMultiplier_);
                 replaceWithScoreTexture(star, otherGameObject);
-                game_.getAudio().play(ime::audio::Type::Sfx, "bonusFruitNotMatch.wav");
+                game_.sfx_.play(SoundEffect::BonusFruitNotMatch);
             }
 
             game_.getGameObjects().findByTag("leftBonusFruit")->getSprite().getAnimator().stop();
             game_.getGameObjects().findByTag("rightBonusFruit")->getSprite().getAnimator().stop();
 
-            if (game_.starSpawnSfx_) {
-                game_.starSpawnSfx_->stop();
-                game_.starSpawnSfx_ = nullptr;
-            }
+            game_.sfx_.stop(game_.starSpawnSfx_);
+            game_.starSpawnSfx_ = SfxPlayer::InvalidVoice;
 
             if (!game_.isBonusStage_)
-                game_.mainAudio_->pause();
+                game_.music_.pause();
 
-            game_.getTimer().setTimeout(freezeDuration, [this, otherGameObject] {
+            game_.gameplayTime_.getTimers().schedule(freezeDuration, [this, otherGameObject] {
                 setMovementFreeze(false);
                 otherGameObject->getSprite().setVisible(true);
                 game_.despawnStar();
 
                 if (!game_.isBonusStage_)
-                    game_.mainAudio_->play();
-
-                if (game_.ghostAITimer_.isPaused())
-                    game_.ghostAITimer_.resume();
-
-                if (game_.powerModeTimer_.isPaused())
-                    game_.powerModeTimer_.resume();
-
-                if (game_.superModeTimer_.isPaused())
-                    game_.superModeTimer_.resume();
-
-                if (game_.bonusStageTimer_.isPaused())
-                    game_.bonusStageTimer_.resume();
+                    game_.music_.resume();
             });
         }
     }
@@ -337,9 +309,12 @@ namespace spm {
             auto* pacman = dynamic_cast<PacMan*>(otherGameObject);
             if (pacman && pacman->getState() == PacMan::State::Super) {
                 static_cast<Door *>(door)->burst();
+                game_.recordEvent(TelemetryEventType::DoorBroken, door, static_cast<Door*>(door)->getId());
+                game_.markDoorsChanged();
+                game_.refreshDistanceFields();
                 pacman->getGridMover()->requestMove(pacman->getDirection());
                 game_.updateScore(Constants::Points::BROKEN_DOOR);
-                game_.getAudio().play(ime::audio::Type::Sfx, "doorBroken.wav");
+                game_.sfx_.play(SoundEffect::DoorBroken);
             }
         }
     }
@@ -347,14 +322,7 @@ namespace spm {
     ///////////////////////////////////////////////////////////////
     void CollisionResponseRegisterer::resolveSlowDownSensorCollision(ime::GridObject *sensor, ime::GridObject *objectOnSensor) {
         if (sensor->getClassName() == "Sensor" && sensor->getTag().find("slowDownSensor") != std::string::npos) {
-            float speedMultiplier;
-            if (game_.currentLevel_ == 1)
-                speedMultiplier = 0.40f;
-            else if (game_.currentLevel_ >= 2 && game_.currentLevel_ <= 4)
-                speedMultiplier = 0.45f;
-            else
-                speedMultiplier = 0.50f;
-
+            float speedMultiplier = game_.getLevelTuning().slowLaneSpeedMultiplier;
             char sensorNum = sensor->getTag().back();
             ime::Direction dir = objectOnSensor->getGridMover()->getDirection();
 
@@ -404,17 +372,13 @@ namespace spm {
     }
 
     void CollisionResponseRegisterer::setMovementFreeze(bool freeze) {
-        static auto freezeMovement = [](ime::GridObject* gameObject, bool freeze) {
-            if (gameObject->getGridMover()) { // Movable object
-                gameObject->getSprite().getAnimator().setTimescale(freeze ? 0.0f : 1.0f);
-                gameObject->getGridMover()->setMovementFreeze(freeze);
-            }
-        };
-
-        freezeMovement(game_.getGameObjects().findByTag<PacMan>("pacman"), freeze);
-
-        game_.getGameObjects().forEachInGroup("Ghost", [freeze](ime::GameObject* gameObject) {
-            freezeMovement(static_cast<ime::GridObject*>(gameObject), freeze);
-        });
+        // Actors and mode timers pick up the new timescale on their next update
+        if (freeze) {
+            game_.aiTime_.pause();
+            game_.animationTime_.pause();
+        } else {
+            game_.aiTime_.resume();
+            game_.animationTime_.resume();
+        }
     }
 }
\ No newline at end of file
@@ -179,9 +179,10 @@ namespace spm {
          * @brief Freeze or unfreeze pacman and the ghosts
          * @param freeze True to freeze or false to unfreeze
          *
-         * When @a freeze is set to @a true, the actors movement and
-         * animation will be frozen in time and when it is set to @a
-         * false, actor movement and animations will resume as before
+         * When @a freeze is set to @a true, the AI and animation time
+         * domains are paused, freezing actor movement, actor animations
+         * and the mode timers. When it is set to @a false, they resume
+         * as before. Calls must be balanced
          */
         void setMovementFreeze(bool freeze);
 
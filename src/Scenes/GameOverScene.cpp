@@ -33,6 +33,12 @@
 using namespace ime::ui;
 
 namespace spm {
+    ///////////////////////////////////////////////////////////////
+    GameOverScene::GameOverScene(GameSession& session, GameServices& services) :
+        session_{session},
+        services_{services}
+    {}
+
     ///////////////////////////////////////////////////////////////
     void GameOverScene::onEnter() {
         updateLeaderboard();
@@ -42,12 +48,9 @@ namespace spm {
 
     ///////////////////////////////////////////////////////////////
     void GameOverScene::updateLeaderboard() {
-        auto playerScore = getCache().getValue<int>("CURRENT_SCORE");
-        auto playerLevel = getCache().getValue<int>("CURRENT_LEVEL");
-
         auto score = Score();
-        score.setValue(playerScore);
-        score.setLevel(playerLevel);
+        score.setValue(session_.getScore());
+        score.setLevel(session_.getLevel());
         score.setOwner(getCache().getValue<std::string>("PLAYER_NAME"));
 
         auto scoreboard = getCache().getValue<std::shared_ptr<Scoreboard>>("SCOREBOARD");
@@ -58,20 +61,21 @@ namespace spm {
     ///////////////////////////////////////////////////////////////
     void GameOverScene::initGui() {
         view_.init(getGui(), getCache().getValue<bool>("PLAYER_WON_GAME"));
-        getGui().getWidget<Label>("lblHighScoreVal")->setText(std::to_string(getCache().getValue<int>("HIGH_SCORE")));
-        getGui().getWidget<Label>("lblScoreVal")->setText(std::to_string(getCache().getValue<int>("CURRENT_SCORE")));
-        getGui().getWidget<Label>("lblLevelVal")->setText(std::to_string(getCache().getValue<int>("CURRENT_LEVEL")));
+        getGui().getWidget<Label>("lblHighScoreVal")->setText(std::to_string(session_.getHighScore()));
+        getGui().getWidget<Label>("lblScoreVal")->setText(std::to_string(session_.getScore()));
+        getGui().getWidget<Label>("lblLevelVal")->setText(std::to_string(session_.getLevel()));
         getGui().getWidget<Label>("lblPlayerNameVal")->setText(getCache().getValue<std::string>("PLAYER_NAME"));
     }
 
     ///////////////////////////////////////////////////////////////
     void GameOverScene::initButtonEvents() {
         getGui().getWidget("btnRetry")->on("click", ime::Callback<>([this] {
-            utils::resetCache(getCache());
             getEngine().removeAllScenesExceptActive();
+            session_.startNewGame();
+            utils::resetCache(getCache());
             getEngine().popScene(); // Destroy this scene
-            getEngine().pushScene(std::make_unique<GameplayScene>());
-            getEngine().pushScene(std::make_unique<LevelStartScene>());
+            getEngine().pushScene(std::make_unique<GameplayScene>(session_, services_));
+            getEngine().pushScene(std::make_unique<LevelStartScene>(session_));
         }));
 
         // Exit to the games main menu when "Exit to Main Menu" is clicked
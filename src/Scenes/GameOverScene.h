@@ -26,6 +26,8 @@
 #define SUPERPACMAN_GAMEOVERSCENE_H
 
 #include "Views/GameOverSceneView.h"
+#include "Session/GameSession.h"
+#include "Session/GameServices.h"
 #include <IME/core/scene/Scene.h>
 
 namespace spm {
@@ -39,6 +41,13 @@ namespace spm {
      */
     class GameOverScene : public ime::Scene {
     public:
+        /**
+         * @brief Constructor
+         * @param session The progress of the player
+         * @param services Objects shared by the gameplay scenes
+         */
+        GameOverScene(GameSession& session, GameServices& services);
+
         /**
          * @brief Enter the scene
          *
@@ -64,6 +73,8 @@ namespace spm {
         void initButtonEvents();
 
     private:
+        GameSession& session_;   //!< The progress of the player
+        GameServices& services_; //!< Handed to the gameplay scenes this scene starts
         GameOverSceneView view_;
     };
 }
@@ -31,25 +31,59 @@
 #include "PathFinders/GhostGridMover.h"
 #include "PathFinders/PacManGridMover.h"
 #include "Common/ObjectReferenceKeeper.h"
-#include "AI/ghost/ScatterState.h"
 #include <IME/core/engine/Engine.h>
 #include <IME/ui/widgets/Label.h>
 #include <IME/ui/widgets/HorizontalLayout.h>
 #include <IME/utility/Utils.h>
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <random>
 
 namespace spm {
     ///////////////////////////////////////////////////////////////
     auto static flashAnimCutoffTime = ime::seconds(2);
 
     ///////////////////////////////////////////////////////////////
-    GameplayScene::GameplayScene() :
+    auto static digitGlyphSize = ime::Vector2u{15, 19}; // digits.png, made by the GlyphAtlas tool from namco.ttf at 15 pixels
+
+    ///////////////////////////////////////////////////////////////
+    static const std::array<std::string, 4>& getGhostTags() {
+        // Same order as spm::SessionState::ghosts
+        static const std::array<std::string, 4> ghostTags = {"blinky", "pinky", "inky", "clyde"};
+        return ghostTags;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    static ime::Direction toGridDirection(Action action) {
+        switch (action) {
+            case Direction::Up:     return ime::Up;
+            case Direction::Left:   return ime::Left;
+            case Direction::Down:   return ime::Down;
+            case Direction::Right:  return ime::Right;
+            default:                return ime::Unknown;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    GameplayScene::GameplayScene(GameSession& session, GameServices& services) :
+        session_{session},
+        services_{services},
         currentLevel_{-1},
         pointsMultiplier_{1},
         isPaused_{false},
         view_{nullptr},
-        mainAudio_{nullptr},
-        starSpawnSfx_{nullptr},
+        aiTime_{&gameplayTime_},
+        animationTime_{&gameplayTime_},
+        timestep_{ime::seconds(1.0f / Constants::SIMULATION_TICK_RATE)},
+        tick_{0},
+        areDoorsChanged_{false},
+        isAutopilotActionStale_{false},
+        pacmanGridMover_{nullptr},
+        presentedLives_{0},
+        sessionListenerId_{-1},
+        random_{std::random_device{}()},
+        starSpawnSfx_{SfxPlayer::InvalidVoice},
         scatterWaveLevel_{0},
         chaseWaveLevel_{0},
         numFruitsEaten_{0},
@@ -59,52 +93,74 @@ namespace spm {
         starAppeared_{false},
         isBonusStage_{false},
         collisionResponseRegisterer_{*this}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    GameplayScene::GameplayScene(GameSession& session, GameServices& services, const SessionState& state, std::uint64_t tick) :
+        GameplayScene(session, services)
     {
-        // IME v2.6.0 does not allow a non-repeating timer to be restarted in
-        // its timeout callback. Since this timer is used to control two states
-        // it needs to immediately start countdown when one state terminates.
-        ghostAITimer_.setLoop(true);
+        tick_ = tick;
+        pendingState_ = state;
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::onEnter() {
-        getAudio().setMasterVolume(getCache().getValue<float>("MASTER_VOLUME"));
-        currentLevel_ = getCache().getValue<int>("CURRENT_LEVEL");
+        getAudio().setMasterVolume(session_.getMasterVolume());
+        sfx_.setVolume(session_.getMasterVolume());
+        music_.setVolume(session_.getMasterVolume());
+        currentLevel_ = session_.getLevel();
 
-        if (currentLevel_ == getCache().getValue<int>("BONUS_STAGE")) {
-            getCache().setValue("BONUS_STAGE", currentLevel_ + 4); // Next bonus stage
-            isBonusStage_ = true;
-        }
+        // Every game starts on the first level, rewinding does not start a new game
+        if (currentLevel_ == 1 && !pendingState_)
+            recordEvent(TelemetryEventType::GameStarted);
 
-        getCache().setValue("GHOSTS_FRIGHTENED_MODE_DURATION", getCache().getValue<ime::Time>("GHOSTS_FRIGHTENED_MODE_DURATION") - ime::seconds(1));
-        getCache().setValue("PACMAN_SUPER_MODE_DURATION", getCache().getValue<ime::Time>("PACMAN_SUPER_MODE_DURATION") - ime::seconds(1));
+        if (pendingState_) // The level was already set up before it was rewound
+            isBonusStage_ = pendingState_->isBonusStage;
+        else {
+            services_.rewindBuffer->clear();
+
+            if (currentLevel_ == session_.getNextBonusStage()) {
+                session_.setNextBonusStage(currentLevel_ + GameSession::BonusStageInterval);
+                isBonusStage_ = true;
+            }
+        }
 
         initGui();
         initGrid();
         initGameObjects();
+        initDistanceFields();
         initMovementControllers();
         initSceneLevelEvents();
         initEngineLevelEvents();
         initCollisions();
         initLevelStartCountdown();
+
+        if (pendingState_) {
+            restoreState(*pendingState_);
+            pendingState_.reset();
+        }
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::initGui() {
         view_ = new CommonView(getGui()),
-        view_->init(getCache().getValue<int>("CURRENT_LEVEL"), getCache().getValue<int>("PLAYER_LIVES"));
-        view_->setHighScore(getCache().getValue<int>("HIGH_SCORE"));
-        view_->setScore(getCache().getValue<int>("CURRENT_SCORE"));
-
-        if (isBonusStage_) {
-            ime::ui::Label::Ptr lblRemainingTime = ime::ui::Label::create("");
-            lblRemainingTime->setName("lblRemainingTime");
-            lblRemainingTime->setTextSize(15);
-            lblRemainingTime->getRenderer()->setTextColour(ime::Colour::White);
-            lblRemainingTime->setOrigin(0.5f, 0.5f);
-            lblRemainingTime->setPosition(242, 221);
-            getGui().addWidget(std::move(lblRemainingTime));
-        }
+        view_->init(currentLevel_, session_.getLives());
+        presentedLives_ = session_.getLives();
+        view_->setHighScore(session_.getHighScore());
+        view_->setScore(session_.getScore());
+
+        // The score is handed to the view once per frame (see onUpdate)
+        sessionListenerId_ = session_.onChange([this](GameSession::Field field) {
+            if (field == GameSession::Field::Level)
+                view_->setLevel(static_cast<unsigned int>(session_.getLevel()));
+            else if (field == GameSession::Field::Lives) {
+                for (; presentedLives_ < session_.getLives(); ++presentedLives_)
+                    view_->addLife();
+
+                for (; presentedLives_ > session_.getLives(); --presentedLives_)
+                    view_->removeLife();
+            }
+        });
     }
 
     ///////////////////////////////////////////////////////////////
@@ -113,6 +169,15 @@ namespace spm {
         grid_ = std::make_unique<Grid>(getGrid());
         grid_->create(currentLevel_);
         grid_->init();
+
+        // The countdown changes every frame, so it is drawn from pre-rasterised digits instead of a label
+        if (isBonusStage_) {
+            getRenderLayers().create("Hud");
+            remainingTimeDisplay_ = std::make_unique<DigitDisplay>("digits.png", digitGlyphSize, 5);
+            remainingTimeDisplay_->setPosition({242, 221});
+            remainingTimeDisplay_->setVisible(false);
+            remainingTimeDisplay_->addToRenderLayer(getRenderLayers(), "Hud");
+        }
     }
 
     ///////////////////////////////////////////////////////////////
@@ -120,7 +185,7 @@ namespace spm {
         std::vector<ime::Index> keyIndexes;
         grid_->forEachGameObject([this, &keyIndexes](ime::GameObject* gameObject) {
             if (gameObject->getClassName() == "PacMan")
-                static_cast<PacMan*>(gameObject)->setLivesCount(getCache().getValue<int>("PLAYER_LIVES"));
+                static_cast<PacMan*>(gameObject)->setLivesCount(session_.getLives());
             else if (gameObject->getClassName() == "Door")
                 static_cast<Door*>(gameObject)->lock();
             else if (gameObject->getClassName() == "Fruit")
@@ -151,19 +216,74 @@ namespace spm {
         }
     }
 
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::initDistanceFields() {
+        pacmanDistanceField_ = std::make_unique<DistanceField>(*grid_, DistanceField::Obstacles::WallsAndDoors);
+        respawnDistanceField_ = std::make_unique<DistanceField>(*grid_, DistanceField::Obstacles::Walls);
+        respawnDistanceField_->compute(Constants::EatenGhostRespawnTile);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::refreshDistanceFields() {
+        pacmanDistanceField_->refreshObstacles();
+        pacmanDistanceField_->recompute();
+    }
+
     ///////////////////////////////////////////////////////////////
     void GameplayScene::initMovementControllers() {
         auto* pacman = getGameObjects().findByTag<PacMan>("pacman");
         auto pacmanController = std::make_unique<PacManGridMover>(*grid_, pacman);
+
+        // The search for the next tile starts as pacman enters a tile, its result is applied by onUpdate.
+        // A tile is skipped while the previous search is still running, pacman then keeps his direction
+        if (services_.autopilot) {
+            isAutopilotActionStale_ = autopilotAction_.valid();
+            pacmanController->onMoveEnd([this](ime::Index) {
+                if (!autopilotAction_.valid() && captureState(autopilotState_))
+                    autopilotAction_ = services_.autopilot->chooseNextAction(autopilotState_, std::chrono::milliseconds(services_.autopilotThinkTime));
+            });
+        }
+
+        // The outcome of every move of pacman, for the parity check of the headless environment
+        if (services_.trace) {
+            pacmanController->onMoveEnd([this](ime::Index) {
+                if (captureState(tracedState_))
+                    services_.trace->record(tick_, tracedState_);
+            });
+        }
+
         pacmanController->init();
-        getGridMovers().addObject(std::move(pacmanController));
+        pacmanGridMover_ = pacmanController.get();
+
+        // One search per pacman step, shared by all the ghosts. Ghosts only chase along it from a certain level
+        if (currentLevel_ >= Constants::SHORTEST_PATH_CHASE_LEVEL) {
+            pacmanDistanceField_->compute(pacmanController->getCurrentTileIndex());
+            pacmanController->onMoveEnd([this](ime::Index index) {
+                pacmanDistanceField_->compute(index);
+            });
+        }
+
+        addGridMover(std::move(pacmanController));
+        pacman->setTimeDomains(aiTime_, animationTime_);
 
         getGameObjects().forEachInGroup("Ghost", [this](ime::GameObject* gameObject) {
-            auto ghostMover = std::make_unique<GhostGridMover>(*grid_, static_cast<Ghost*>(gameObject));
-            getGridMovers().addObject(std::move(ghostMover));
+            auto ghostMover = std::make_unique<GhostGridMover>(*grid_, static_cast<Ghost*>(gameObject), random_, getLevelTuning());
+            ghostMover->addDistanceField(*respawnDistanceField_);
+
+            if (currentLevel_ >= Constants::SHORTEST_PATH_CHASE_LEVEL)
+                ghostMover->addDistanceField(*pacmanDistanceField_);
+
+            addGridMover(std::move(ghostMover));
+            static_cast<Ghost*>(gameObject)->setTimeDomains(aiTime_, animationTime_);
         });
     }
 
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::addGridMover(std::unique_ptr<ime::GridMover> gridMover) {
+        previousPositions_.push_back(gridMover->getTarget()->getTransform().getPosition());
+        gridMovers_.push_back(std::move(gridMover));
+    }
+
     ///////////////////////////////////////////////////////////////
     void GameplayScene::initCollisions() {
         auto* pacman = getGameObjects().findByTag<PacMan>("pacman");
@@ -195,12 +315,14 @@ namespace spm {
     ///////////////////////////////////////////////////////////////
     void GameplayScene::spawnStar() {
         ime::GridObject::Ptr star = std::make_unique<Star>(*this);
-        grid_->addGameObject(std::move(star), ime::Index{15, 13});
+        ime::GridObject* starPtr = star.get();
+        grid_->addGameObject(std::move(star), Constants::StarSpawnTile);
+        recordEvent(TelemetryEventType::StarSpawned, starPtr);
 
         ime::GameObject* leftFruit = getGameObjects().findByTag("leftBonusFruit");
         int numFrames = leftFruit->getSprite().getAnimator().getAnimation("slide")->getFrameCount();
         auto* anim = leftFruit->getSprite().getAnimator().getAnimation("slide").get();
-        int stopFrame = ime::utility::generateRandomNum(0, numFrames - 1);
+        int stopFrame = random_.nextInt(0, numFrames - 1);
         leftFruit->getSprite().getAnimator().getAnimation("slide")->onFrameSwitch([anim, stopFrame](ime::AnimationFrame* frame) {
             if (frame->getIndex() == stopFrame)
                 anim->setPlaybackSpeed(0.0f);
@@ -214,18 +336,15 @@ namespace spm {
             despawnStar();
         });
 
-        starSpawnSfx_ = getAudio().play(ime::audio::Type::Sfx, "starSpawned.wav");
-        starSpawnSfx_->setLoop(true);
+        starSpawnSfx_ = sfx_.play(SoundEffect::StarSpawned, true);
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::despawnStar() {
-        if (starSpawnSfx_) {
-            starSpawnSfx_->stop();
-            starSpawnSfx_ = nullptr;
-        }
+        sfx_.stop(starSpawnSfx_);
+        starSpawnSfx_ = SfxPlayer::InvalidVoice;
 
-        starTimer_.stop();
+        aiTime_.getTimers().cancel(starTimer_);
 
         ime::GameObject* leftFruit = getGameObjects().findByTag("leftBonusFruit");
         ime::GameObject* rightFruit = getGameObjects().findByTag("rightBonusFruit");
@@ -239,11 +358,14 @@ namespace spm {
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::endGameplay() {
+        recordEvent(TelemetryEventType::GameEnded, nullptr, 0, session_.getScore());
         despawnStar();
         setVisibleOnPause(true);
         getAudio().setMute(true);
+        sfx_.setMute(true);
+        music_.setMute(true);
         getGui().setOpacity(0.0f);
-        getEngine().pushScene(std::make_unique<GameOverScene>());
+        getEngine().pushScene(std::make_unique<GameOverScene>(session_, services_));
     }
 
     ///////////////////////////////////////////////////////////////
@@ -251,6 +373,16 @@ namespace spm {
         getInput().onKeyUp([this](ime::Key key) {
             if ((key == ime::Key::P || key == ime::Key::Escape))
                 pauseGame();
+#ifndef NDEBUG
+            else if (key == ime::Key::F1) // Slow motion
+                gameplayTime_.setTimescale(0.25f);
+            else if (key == ime::Key::F2)
+                gameplayTime_.setTimescale(1.0f);
+            else if (key == ime::Key::F3) // Fast-forward
+                gameplayTime_.setTimescale(4.0f);
+            else if (key == ime::Key::F4)
+                rewind(ime::seconds(1));
+#endif
         });
 
         getEventEmitter().on("levelStartCountdownComplete", ime::Callback<>([this] {
@@ -268,29 +400,29 @@ namespace spm {
                 configureTimer(bonusStageTimer_, ime::seconds(Constants::BONUS_STAGE_DURATION), [this] {
                     getEventEmitter().emit("levelComplete");
                 });
-
-                bonusStageTimer_.onUpdate([this](ime::Timer& timer) {
-                    getGui().getWidget<ime::ui::Label>("lblRemainingTime")->setText(std::to_string(timer.getRemainingDuration().asMilliseconds()));
-                });
             } else {
                 getGameObjects().forEachInGroup("Ghost", [](ime::GameObject* gameObject) {
                     auto* ghost = static_cast<Ghost*>(gameObject);
                     ghost->clearState();
-                    ghost->setState(std::make_unique<ScatterState>());
+                    ghost->setState<ScatterState>();
                 });
 
                 startGhostHouseArrestTimer();
                 startScatterTimer();
 
-                mainAudio_ = getAudio().play(ime::audio::Type::Sfx, "wieu_wieu_slow.ogg");
-                mainAudio_->setLoop(true);
+                music_.play(MusicTrack::Siren);
             }
         }));
 
         getEventEmitter().addOnceEventListener("levelComplete", ime::Callback<>([this] {
+            recordEvent(TelemetryEventType::LevelCleared, getGameObjects().findByTag<PacMan>("pacman"), 0,
+                static_cast<int>(tick_ * 1000 / Constants::SIMULATION_TICK_RATE));
+
             getWindow().suspendedEventListener(onWindowCloseId_, true);
-            updateScore(bonusStageTimer_.getRemainingDuration().asMilliseconds());
+            updateScore(aiTime_.getTimers().getRemainingDuration(bonusStageTimer_).asMilliseconds());
             getAudio().stopAll();
+            sfx_.stopAll();
+            music_.stop();
             stopAllTimers();
             despawnStar();
             getGameObjects().getGroup("Ghost").removeAll();
@@ -299,7 +431,7 @@ namespace spm {
             pacman->getSprite().getAnimator().complete();
             pacman->getGridMover()->setMovementFreeze(true);
 
-            getTimer().setTimeout(ime::seconds(0.5), [this, pacman] {
+            gameplayTime_.getTimers().schedule(ime::seconds(0.5), [this, pacman] {
                 getGameObjects().getGroup("Pellet").removeAll();
                 getGameObjects().getGroup("Fruit").removeAll();
                 getGameObjects().getGroup("Key").removeAll();
@@ -307,25 +439,25 @@ namespace spm {
                 grid_->flash(currentLevel_);
 
                 grid_->onFlashStop([this] {
-                    if (currentLevel_ == 16) {
+                    if (currentLevel_ == TuningTable::LevelCount) {
                         getCache().setValue("PLAYER_WON_GAME", true);
                         endGameplay();
                     } else {
-                        getTimer().setTimeout(ime::seconds(1), [this] {
+                        gameplayTime_.getTimers().schedule(ime::seconds(1), [this] {
                             getEventEmitter().emit("startNewLevel");
                         });
                     }
                 });
 
-                getAudio().play(ime::audio::Type::Sfx, "levelComplete.ogg");
+                sfx_.play(SoundEffect::LevelComplete);
             });
         }));
 
         getEventEmitter().on("startNewLevel", ime::Callback<>([this] {
-            getCache().setValue("CURRENT_LEVEL", currentLevel_ + 1);
+            session_.setLevel(currentLevel_ + 1);
             getEngine().popScene();
-            getEngine().pushScene(std::make_unique<GameplayScene>());
-            getEngine().pushScene(std::make_unique<LevelStartScene>());
+            getEngine().pushScene(std::make_unique<GameplayScene>(session_, services_));
+            getEngine().pushScene(std::make_unique<LevelStartScene>(session_));
         }));
     }
 
@@ -340,27 +472,23 @@ namespace spm {
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::updateScore(int points) {
-        auto newScore = getCache().getValue<int>("CURRENT_SCORE") + points;
-        getCache().setValue("CURRENT_SCORE", newScore);
-        view_->setScore(newScore);
+        auto newScore = session_.getScore() + points;
+        session_.setScore(newScore);
 
-        if (newScore > getCache().getValue<int>("HIGH_SCORE")) {
-            getCache().setValue("HIGH_SCORE", newScore);
-            view_->setHighScore(newScore);
-        }
+        if (newScore > session_.getHighScore())
+            session_.setHighScore(newScore);
 
-        auto extraLivesGiven = getCache().getValue<int>("NUM_EXTRA_LIVES_WON");
+        auto extraLivesGiven = session_.getExtraLivesWon();
         if (newScore >= Constants::FIRST_EXTRA_LIFE_MIN_SCORE && extraLivesGiven == 0 ||
             newScore >= Constants::SECOND_EXTRA_LIFE_MIN_SCORE && extraLivesGiven == 1 ||
             newScore >= Constants::THIRD_EXTRA_LIFE_MIN_SCORE && extraLivesGiven == 2)
         {
-            getCache().setValue("NUM_EXTRA_LIVES_WON", extraLivesGiven + 1);
+            session_.setExtraLivesWon(extraLivesGiven + 1);
             auto* pacman = getGameObjects().findByTag<PacMan>("pacman");
             pacman->addLife();
-            getCache().setValue("PLAYER_LIVES", pacman->getLivesCount());
-            view_->addLife();
+            session_.setLives(pacman->getLivesCount());
 
-            getAudio().play(ime::audio::Type::Sfx, "extraLife.wav");
+            sfx_.play(SoundEffect::ExtraLife);
         }
     }
 
@@ -370,136 +498,170 @@ namespace spm {
         getGui().getWidget<ime::ui::Label>("lblReady")->setVisible(true);
         getGameObjects().findByTag("pacman")->getSprite().setVisible(false);
 
-        int counter = Constants::LEVEL_START_DELAY;
-        getTimer().setInterval(ime::seconds(0.5f), [this, counter]() mutable {
-            if (counter-- == 0)
-                getEventEmitter().emit("levelStartCountdownComplete");
-        }, counter);
+        // Scheduled with the gameplay timeouts so that the countdown is not mistaken for a capturable state
+        gameplayTime_.getTimers().schedule(ime::seconds(0.5f * (Constants::LEVEL_START_DELAY + 1)), [this] {
+            getEventEmitter().emit("levelStartCountdownComplete");
+        });
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::startGhostHouseArrestTimer() {
-        auto startProbationTimer = [this](const std::string& tag, float duration) {
-            auto* ghost = getGameObjects().getGroup("Ghost").findByTag<Ghost>(tag);
+        auto startProbationTimer = [this](std::size_t ghostIndex, float duration) {
+            auto* ghost = getGameObjects().getGroup("Ghost").findByTag<Ghost>(getGhostTags()[ghostIndex]);
             assert(ghost && "Failed to start probation timer: Invalid ghost tag");
 
             if (!ghost->isLockedInGhostHouse())
                 return;
 
-            float probationDuration = duration - currentLevel_;
-
-            if (probationDuration <= 0)
+            // The tuning values already shorten the arrest on higher levels
+            if (duration <= 0)
                 ghost->setLockInGhostHouse(false);
             else {
-                getTimer().setTimeout(ime::seconds(probationDuration), [ghost] {
+                aiTime_.getTimers().cancel(houseArrestTimers_[ghostIndex]);
+                houseArrestTimers_[ghostIndex] = aiTime_.getTimers().schedule(ime::seconds(duration), [ghost] {
                     ghost->setLockInGhostHouse(false);
                 });
             }
         };
 
-        startProbationTimer("inky", Constants::INKY_HOUSE_ARREST_DURATION);
-        startProbationTimer("clyde", Constants::CLYDE_HOUSE_ARREST_DURATION);
+        startProbationTimer(2, getLevelTuning().inkyHouseArrestDuration);
+        startProbationTimer(3, getLevelTuning().clydeHouseArrestDuration);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::recordEvent(TelemetryEventType type, ime::GridObject* object, int subject, int value) {
+        if (!services_.telemetry)
+            return;
+
+        auto event = TelemetryEvent();
+        event.tick = tick_;
+        event.type = type;
+        event.level = static_cast<std::uint8_t>(currentLevel_);
+        event.subject = static_cast<std::uint8_t>(subject);
+        event.value = value;
+
+        if (object) {
+            ime::Index index = getGrid().getTileOccupiedByChild(object).getIndex();
+            event.row = static_cast<std::int16_t>(index.row);
+            event.colm = static_cast<std::int16_t>(index.colm);
+        }
+
+        services_.telemetry->record(event);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int GameplayScene::getGhostIndex(const ime::GameObject* ghost) {
+        const auto& ghostTags = getGhostTags();
+        auto tag = std::find(ghostTags.begin(), ghostTags.end(), ghost->getTag());
+        assert(tag != ghostTags.end() && "Invalid ghost tag");
+        return static_cast<int>(tag - ghostTags.begin());
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::startScatterTimer() {
-        ghostAITimer_.stop();
+        aiTime_.getTimers().cancel(ghostAITimer_);
 
         configureTimer(ghostAITimer_, getScatterModeDuration(), [this] {
-            if (chaseWaveLevel_ < 4)
-                chaseWaveLevel_++;
-
-            startChaseTimer();
+            endScatterMode();
         });
 
         isChaseMode_ = false;
+        recordEvent(TelemetryEventType::ScatterModeBegin, nullptr, static_cast<int>(scatterWaveLevel_), getScatterModeDuration().asMilliseconds());
         emit(GameEvent::ScatterModeBegin);
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::startChaseTimer() {
-        ghostAITimer_.stop();
+        aiTime_.getTimers().cancel(ghostAITimer_);
 
         configureTimer(ghostAITimer_, getChaseModeDuration(), [this] {
-            if (scatterWaveLevel_ < 4)
-                scatterWaveLevel_++;
-
-            startScatterTimer();
+            endChaseMode();
         });
 
         isChaseMode_ = true;
+        recordEvent(TelemetryEventType::ChaseModeBegin, nullptr, static_cast<int>(chaseWaveLevel_), getChaseModeDuration().asMilliseconds());
         emit(GameEvent::ChaseModeBegin);
     }
 
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::endScatterMode() {
+        if (chaseWaveLevel_ < 4)
+            chaseWaveLevel_++;
+
+        startChaseTimer();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::endChaseMode() {
+        if (scatterWaveLevel_ < 4)
+            scatterWaveLevel_++;
+
+        startScatterTimer();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::endPowerMode() {
+        pointsMultiplier_ = 1;
+        recordEvent(TelemetryEventType::PowerModeEnd);
+
+        if (!aiTime_.getTimers().isRunning(superModeTimer_))
+            resumeGhostAITimer();
+
+        emit(GameEvent::FrightenedModeEnd);
+
+        music_.switchTo(MusicTrack::Siren);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::endSuperMode() {
+        recordEvent(TelemetryEventType::SuperModeEnd);
+        emit(GameEvent::SuperModeEnd);
+        resumeGhostAITimer();
+    }
+
     ///////////////////////////////////////////////////////////////
     ime::Time GameplayScene::getScatterModeDuration() const {
-        if (scatterWaveLevel_ <= 2) {
-            if (currentLevel_ < 5)
-                return ime::seconds(7.0f);
-            else
-                return ime::seconds(5.0f);
-        } else if (scatterWaveLevel_ == 3)
-            return ime::seconds(5);
-        else {
-            if (currentLevel_ == 1)
-                return ime::seconds(5.0f);
-            else
-                return ime::seconds(1.0f / getWindow().getFrameRateLimit()); // one frame
-        }
+        // A wave of 0 seconds lasts a single simulation step
+        return ime::seconds(std::max(getLevelTuning().scatterDurations[scatterWaveLevel_], timestep_.getStep().asSeconds()));
     }
 
     ///////////////////////////////////////////////////////////////
     ime::Time GameplayScene::getChaseModeDuration() const {
-        if (chaseWaveLevel_ <= 2)
-            return ime::seconds(20.0f);
-        else if (chaseWaveLevel_ == 3) {
-            if (currentLevel_ == 1)
-                return ime::seconds(20.0f);
-            else
-                return ime::minutes(17);
-        } else
-            return ime::hours(24);
+        return ime::seconds(getLevelTuning().chaseDurations[chaseWaveLevel_]);
     }
 
     ///////////////////////////////////////////////////////////////
     ime::Time GameplayScene::getFrightenedModeDuration() {
-        auto duration = getCache().getValue<ime::Time>("GHOSTS_FRIGHTENED_MODE_DURATION");
-
-        if (duration < ime::Time::Zero)
-            return ime::Time::Zero;
-
-        return duration;
+        return ime::seconds(getLevelTuning().frightenedDuration);
     }
 
     ///////////////////////////////////////////////////////////////
     ime::Time GameplayScene::getSuperModeDuration() {
-        auto duration = getCache().getValue<ime::Time>("PACMAN_SUPER_MODE_DURATION");
+        return ime::seconds(getLevelTuning().superDuration);
+    }
 
-        if (duration <= ime::Time::Zero)
-            return ime::seconds(2.0f);
-        else
-            return duration;
+    ///////////////////////////////////////////////////////////////
+    const LevelTuning& GameplayScene::getLevelTuning() const {
+        return services_.tuning->getLevel(currentLevel_);
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::pauseGhostAITimer() {
-        if (ghostAITimer_.isRunning())
-            ghostAITimer_.pause();
+        aiTime_.getTimers().pause(ghostAITimer_);
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::resumeGhostAITimer() {
-        if (ghostAITimer_.isPaused())
-            ghostAITimer_.resume();
+        aiTime_.getTimers().resume(ghostAITimer_);
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::stopAllTimers() {
-        ghostAITimer_.stop();
-        superModeTimer_.stop();
-        powerModeTimer_.stop();
-        starTimer_.stop();
-        bonusStageTimer_.stop();
+        aiTime_.getTimers().cancel(ghostAITimer_);
+        aiTime_.getTimers().cancel(superModeTimer_);
+        aiTime_.getTimers().cancel(powerModeTimer_);
+        aiTime_.getTimers().cancel(starTimer_);
+        aiTime_.getTimers().cancel(bonusStageTimer_);
     }
 
     ///////////////////////////////////////////////////////////////
@@ -526,7 +688,8 @@ namespace spm {
             ghost->getSprite().setVisible(true);
         });
 
-        getGridMovers().removeAll();
+        gridMovers_.clear();
+        previousPositions_.clear();
         initMovementControllers();
     }
 
@@ -540,14 +703,13 @@ namespace spm {
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::configureTimer(ime::Timer &timer, ime::Time duration, ime::Callback<> timeoutCallback) {
-        if (timer.isRunning())
-            timer.setInterval(timer.getRemainingDuration() + duration);
+    void GameplayScene::configureTimer(TimerHandle& timer, ime::Time duration, ime::Callback<> timeoutCallback) {
+        if (aiTime_.getTimers().isRunning(timer))
+            aiTime_.getTimers().extend(timer, duration);
         else {
             assert(timeoutCallback);
-            timer.setInterval(duration);
-            timer.onTimeout(timeoutCallback);
-            timer.start();
+            aiTime_.getTimers().cancel(timer);
+            timer = aiTime_.getTimers().schedule(duration, std::move(timeoutCallback));
         }
     }
 
@@ -558,6 +720,8 @@ namespace spm {
 
         isPaused_ = true;
         getAudio().pauseAll();
+        sfx_.pauseAll();
+        music_.pause();
         setVisibleOnPause(true);
         getEngine().pushCachedScene("PauseMenuScene");
     }
@@ -568,8 +732,12 @@ namespace spm {
 
         if (isPaused_) {
             isPaused_ = false;
-            getAudio().setMasterVolume(getCache().getValue<float>("MASTER_VOLUME"));
+            getAudio().setMasterVolume(session_.getMasterVolume());
             getAudio().playAll();
+            sfx_.setVolume(session_.getMasterVolume());
+            music_.setVolume(session_.getMasterVolume());
+            sfx_.resumeAll();
+            music_.resume();
         } else
             resetLevel();
 
@@ -580,6 +748,8 @@ namespace spm {
     void GameplayScene::resetLevel() {
         despawnStar();
         getAudio().stopAll();
+        sfx_.stopAll();
+        music_.stop();
         stopAllTimers();
         resetActors();
         initLevelStartCountdown();
@@ -588,6 +758,8 @@ namespace spm {
     ///////////////////////////////////////////////////////////////
     void GameplayScene::onPause() {
         getAudio().pauseAll();
+        sfx_.pauseAll();
+        music_.pause();
         getWindow().suspendedEventListener(onWindowCloseId_, true);
     }
 
@@ -604,11 +776,12 @@ namespace spm {
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::updatePacmanFlashAnimation() {
-        if (superModeTimer_.isRunning()) {
+        if (aiTime_.getTimers().isRunning(superModeTimer_)) {
             auto* pacman = getGameObjects().findByTag<PacMan>("pacman");
-            if (!pacman->isFlashing() && superModeTimer_.getRemainingDuration() <= flashAnimCutoffTime)
+            ime::Time remaining = aiTime_.getTimers().getRemainingDuration(superModeTimer_);
+            if (!pacman->isFlashing() && remaining <= flashAnimCutoffTime)
                 pacman->setFlash(true);
-            else if (pacman->isFlashing() && superModeTimer_.getRemainingDuration() > flashAnimCutoffTime)
+            else if (pacman->isFlashing() && remaining > flashAnimCutoffTime)
             {
                 pacman->setFlash(false);
             }
@@ -617,28 +790,133 @@ namespace spm {
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::updateGhostsFlashAnimation() {
-        if (powerModeTimer_.isRunning()) {
-            getGameObjects().forEachInGroup("Ghost", [this](ime::GameObject* gameObject) {
+        if (aiTime_.getTimers().isRunning(powerModeTimer_)) {
+            ime::Time remaining = aiTime_.getTimers().getRemainingDuration(powerModeTimer_);
+            getGameObjects().forEachInGroup("Ghost", [remaining](ime::GameObject* gameObject) {
                 auto* ghost = static_cast<Ghost*>(gameObject);
-                if (!ghost->isFlashing() && powerModeTimer_.getRemainingDuration() <= flashAnimCutoffTime)
+                if (!ghost->isFlashing() && remaining <= flashAnimCutoffTime)
                     ghost->setFlash(true);
-                else if (ghost->isFlashing() && powerModeTimer_.getRemainingDuration() > flashAnimCutoffTime)
+                else if (ghost->isFlashing() && remaining > flashAnimCutoffTime)
                     ghost->setFlash(false);
             });
         }
     }
 
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::simulate(ime::Time step) {
+        for (std::size_t i = 0; i < gridMovers_.size(); ++i) {
+            if (ime::GridObject* actor = gridMovers_[i]->getTarget())
+                previousPositions_[i] = actor->getTransform().getPosition();
+        }
+
+        gameplayTime_.update(step);
+        aiTime_.update(step);
+
+        for (auto& gridMover : gridMovers_)
+            gridMover->update(step);
+
+        ++tick_;
+        if (services_.rewindBuffer->getCapacity() > 0)
+            recordState();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::recordState() {
+        bool isKeyframe = services_.rewindBuffer->isKeyframeDue(tick_);
+
+        // A tick that is not captured makes the next one a keyframe, which captures the whole maze
+        if (!captureState(recordedState_, isKeyframe))
+            return;
+
+        if (!isKeyframe) {
+            for (const auto& index : eatenItems_) {
+                std::size_t bit = index.row * recordedState_.colms + index.colm;
+                recordedState_.items[bit / 8] &= static_cast<std::uint8_t>(~(1u << (bit % 8)));
+            }
+
+            if (areDoorsChanged_)
+                captureDoors(recordedState_);
+        }
+
+        eatenItems_.clear();
+        areDoorsChanged_ = false;
+        services_.rewindBuffer->record(tick_, recordedState_);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::markItemEaten(ime::GridObject* item) {
+        if (services_.rewindBuffer->getCapacity() > 0)
+            eatenItems_.push_back(getGrid().getTileOccupiedByChild(item).getIndex());
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::markDoorsChanged() {
+        areDoorsChanged_ = true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::interpolateActors(float alpha) {
+        auto maxStepDistance = static_cast<float>(getGrid().getTileSize().x);
+
+        for (std::size_t i = 0; i < gridMovers_.size(); ++i) {
+            ime::GridObject* actor = gridMovers_[i]->getTarget();
+            if (!actor)
+                continue;
+
+            ime::Vector2f current = actor->getTransform().getPosition();
+            ime::Vector2f previous = previousPositions_[i];
+
+            // Teleported actors snap to their new position instead of sliding across the maze
+            if (std::abs(current.x - previous.x) > maxStepDistance || std::abs(current.y - previous.y) > maxStepDistance)
+                previous = current;
+
+            // The sprite is snapped back to the transform the next time the actor moves
+            actor->getSprite().setPosition(previous + (current - previous) * alpha);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::onHandleEvent(ime::Event event) {
+        for (auto& gridMover : gridMovers_)
+            gridMover->handleEvent(event);
+    }
+
     ///////////////////////////////////////////////////////////////
     void GameplayScene::onUpdate(ime::Time deltaTime) {
-        view_->update(deltaTime);
-        grid_->update(deltaTime);
-        ghostAITimer_.update(deltaTime);
-        superModeTimer_.update(deltaTime);
-        powerModeTimer_.update(deltaTime);
-        starTimer_.update(deltaTime);
-        bonusStageTimer_.update(deltaTime);
+        // New values are picked up by the timers, states and sensors that start after the reload
+        services_.tuning->reloadIfChanged();
+
+        if (autopilotAction_.valid() && autopilotAction_.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            Action action = autopilotAction_.get();
+            if (!isAutopilotActionStale_)
+                pacmanGridMover_->steer(toGridDirection(action));
+
+            isAutopilotActionStale_ = false;
+        }
+
+        for (unsigned int numSteps = timestep_.advance(deltaTime); numSteps > 0; --numSteps)
+            simulate(timestep_.getStep());
+
+        interpolateActors(timestep_.getAlpha());
+
+        hudTime_.update(deltaTime);
+        music_.update(deltaTime);
+        grid_->update(gameplayTime_.scale(deltaTime));
+
+        // The view only lays the labels out again when the values change
+        view_->setScore(session_.getScore());
+        view_->setHighScore(session_.getHighScore());
+
+        if (aiTime_.getTimers().isRunning(bonusStageTimer_)) {
+            remainingTimeDisplay_->setValue(static_cast<int>(aiTime_.getTimers().getRemainingDuration(bonusStageTimer_).asMilliseconds()));
+            remainingTimeDisplay_->setVisible(true);
+        }
+
         updatePacmanFlashAnimation();
         updateGhostsFlashAnimation();
+
+        // Applies the HUD changes of the whole frame at once
+        view_->update(hudTime_.scale(deltaTime));
     }
 
     ///////////////////////////////////////////////////////////////
@@ -665,8 +943,366 @@ namespace spm {
         }
     }
 
+    ///////////////////////////////////////////////////////////////
+    bool GameplayScene::captureState(SessionState& state, bool captureMaze) {
+        auto* pacman = getGameObjects().findByTag<PacMan>("pacman");
+
+        // Pending gameplay timeouts mean that the level is starting, frozen or ending
+        if (!pacman || pacman->getState() == PacMan::State::Dying || grid_->isFlashing() || gameplayTime_.getTimers().getCount() > 0)
+            return false;
+
+        state.level = currentLevel_;
+        state.score = session_.getScore();
+        state.highScore = session_.getHighScore();
+        state.lives = pacman->getLivesCount();
+        state.extraLivesWon = session_.getExtraLivesWon();
+        state.nextBonusStage = session_.getNextBonusStage();
+        state.frightenedModeDuration = static_cast<std::int32_t>(getFrightenedModeDuration().asMilliseconds());
+        state.superModeDuration = static_cast<std::int32_t>(getSuperModeDuration().asMilliseconds());
+
+        state.pointsMultiplier = pointsMultiplier_;
+        state.scatterWaveLevel = static_cast<std::uint8_t>(scatterWaveLevel_);
+        state.chaseWaveLevel = static_cast<std::uint8_t>(chaseWaveLevel_);
+        state.numFruitsEaten = static_cast<std::uint16_t>(numFruitsEaten_);
+        state.numPelletsEaten = static_cast<std::uint16_t>(numPelletsEaten_);
+        state.isChaseMode = isChaseMode_;
+        state.starAppeared = starAppeared_;
+        state.isBonusStage = isBonusStage_;
+
+        state.ghostAITimer = captureTimer(aiTime_.getTimers(), ghostAITimer_);
+        state.superModeTimer = captureTimer(aiTime_.getTimers(), superModeTimer_);
+        state.powerModeTimer = captureTimer(aiTime_.getTimers(), powerModeTimer_);
+        state.starTimer = captureTimer(aiTime_.getTimers(), starTimer_);
+        state.bonusStageTimer = captureTimer(aiTime_.getTimers(), bonusStageTimer_);
+
+        captureActor(pacman, state.pacman);
+        state.pacman.state = static_cast<std::int8_t>(pacman->getState());
+
+        for (std::size_t i = 0; i < state.ghosts.size(); ++i) {
+            SessionState::Actor& ghostState = state.ghosts[i];
+            ghostState = SessionState::Actor{};
+
+            auto* ghost = getGameObjects().getGroup("Ghost").findByTag<Ghost>(getGhostTags()[i]);
+            if (ghost && ghost->isActive()) {
+                captureActor(ghost, ghostState);
+                ghostState.state = static_cast<std::int8_t>(ghost->getState());
+                ghostState.isLockedInGhostHouse = ghost->isLockedInGhostHouse();
+                ghostState.isFlat = ghost->isFlat();
+                ghostState.houseArrest = captureTimer(aiTime_.getTimers(), houseArrestTimers_[i]);
+            }
+        }
+
+        if (captureMaze) {
+            captureItems(state);
+            captureDoors(state);
+        }
+
+        state.randomState = random_.getState();
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::captureItems(SessionState& state) {
+        state.rows = static_cast<std::uint16_t>(getGrid().getSizeInTiles().y);
+        state.colms = static_cast<std::uint16_t>(getGrid().getSizeInTiles().x);
+        state.items.assign((state.rows * state.colms + 7) / 8, 0);
+
+        for (const auto* group : {"Pellet", "Fruit", "Key"}) {
+            getGameObjects().forEachInGroup(group, [this, &state](ime::GameObject* item) {
+                if (!item->isActive()) // Eaten this frame
+                    return;
+
+                ime::Index index = getGrid().getTileOccupiedByChild(static_cast<ime::GridObject*>(item)).getIndex();
+                std::size_t bit = index.row * state.colms + index.colm;
+                state.items[bit / 8] |= static_cast<std::uint8_t>(1u << (bit % 8));
+            });
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::captureDoors(SessionState& state) {
+        // Doors that were unlocked are no longer in the scene, they default to unlocked
+        state.doors.clear();
+        getGameObjects().forEachInGroup("Door", [&state](ime::GameObject* doorBase) {
+            auto* door = static_cast<Door*>(doorBase);
+            auto index = static_cast<std::size_t>(door->getId() - 1);
+
+            if (index >= state.doors.size())
+                state.doors.resize(index + 1, SessionState::DoorStatus::Unlocked);
+
+            if (!door->isActive() || !door->isLocked())
+                state.doors[index] = SessionState::DoorStatus::Unlocked;
+            else if (door->isObstacle())
+                state.doors[index] = SessionState::DoorStatus::Locked;
+            else
+                state.doors[index] = SessionState::DoorStatus::Broken;
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::restoreState(const SessionState& state) {
+        assert(state.level == currentLevel_ && state.isBonusStage == isBonusStage_ && "Cannot restore a session that was captured on a different level");
+        assert(state.rows == getGrid().getSizeInTiles().y && state.colms == getGrid().getSizeInTiles().x && "Session state does not match the grid");
+
+        auto* pacman = getGameObjects().findByTag<PacMan>("pacman");
+        assert(pacman && "Cannot restore a session after the game is over");
+
+        // Discard the current session
+        despawnStar();
+        getAudio().stopAll();
+        sfx_.stopAll();
+        music_.stop();
+        gameplayTime_.getTimers().clear();
+        aiTime_.getTimers().clear();
+        ghostAITimer_ = superModeTimer_ = powerModeTimer_ = starTimer_ = bonusStageTimer_ = TimerHandle{};
+        houseArrestTimers_.fill(TimerHandle{});
+
+        // Lift freezes whose timeouts were discarded above
+        while (aiTime_.isPaused())
+            aiTime_.resume();
+
+        while (animationTime_.isPaused())
+            animationTime_.resume();
+
+        session_.setScore(static_cast<int>(state.score));
+        session_.setHighScore(static_cast<int>(state.highScore));
+        session_.setLives(static_cast<int>(state.lives));
+        session_.setExtraLivesWon(static_cast<int>(state.extraLivesWon));
+        session_.setNextBonusStage(static_cast<int>(state.nextBonusStage));
+
+        pointsMultiplier_ = state.pointsMultiplier;
+        scatterWaveLevel_ = state.scatterWaveLevel;
+        chaseWaveLevel_ = state.chaseWaveLevel;
+        numFruitsEaten_ = state.numFruitsEaten;
+        numPelletsEaten_ = state.numPelletsEaten;
+        isChaseMode_ = state.isChaseMode;
+        starAppeared_ = state.starAppeared;
+
+        pacman->setLivesCount(state.lives);
+
+        // Items can only be removed, the scene must not be ahead of the state
+        for (const auto* group : {"Pellet", "Fruit", "Key"}) {
+            getGameObjects().forEachInGroup(group, [this, &state](ime::GameObject* item) {
+                ime::Index index = getGrid().getTileOccupiedByChild(static_cast<ime::GridObject*>(item)).getIndex();
+                std::size_t bit = index.row * state.colms + index.colm;
+                if (((state.items[bit / 8] >> (bit % 8)) & 1u) == 0)
+                    item->setActive(false);
+            });
+        }
+
+        getGameObjects().forEachInGroup("Door", [&state](ime::GameObject* doorBase) {
+            auto* door = static_cast<Door*>(doorBase);
+            auto index = static_cast<std::size_t>(door->getId() - 1);
+            auto status = index < state.doors.size() ? state.doors[index] : SessionState::DoorStatus::Unlocked;
+
+            if (status != SessionState::DoorStatus::Locked)
+                door->burst();
+
+            if (status == SessionState::DoorStatus::Unlocked)
+                door->setActive(false);
+        });
+
+        refreshDistanceFields();
+
+        // Actors
+        pacman->setState(PacMan::State::Normal);
+        placeActor(pacman, state.pacman);
+
+        for (std::size_t i = 0; i < state.ghosts.size(); ++i) {
+            auto* ghost = getGameObjects().getGroup("Ghost").findByTag<Ghost>(getGhostTags()[i]);
+            if (ghost && state.ghosts[i].isPresent)
+                placeActor(ghost, state.ghosts[i]);
+        }
+
+        gridMovers_.clear();
+        previousPositions_.clear();
+        initMovementControllers();
+
+        getInput().setAllInputEnable(true);
+        getWindow().suspendedEventListener(onWindowCloseId_, false);
+        getGui().getWidget("lblReady")->setVisible(false);
+        pacman->getSprite().setVisible(true);
+
+        // The captured move is started before the state is entered, otherwise the ghost AI would pick its own direction
+        pacman->getGridMover()->requestMove(pacman->getDirection());
+        pacman->setState(static_cast<PacMan::State>(state.pacman.state));
+        advanceActor(pacman, state.pacman);
+
+        for (std::size_t i = 0; i < state.ghosts.size(); ++i) {
+            const SessionState::Actor& ghostState = state.ghosts[i];
+            auto* ghost = getGameObjects().getGroup("Ghost").findByTag<Ghost>(getGhostTags()[i]);
+            if (!ghost || !ghostState.isPresent)
+                continue;
+
+            ghost->setLockInGhostHouse(ghostState.isLockedInGhostHouse);
+            ghost->getGridMover()->requestMove(ghost->getDirection());
+
+            switch (static_cast<Ghost::State>(ghostState.state)) {
+                case Ghost::State::Scatter:
+                    ghost->setState<ScatterState>();
+                    break;
+                case Ghost::State::Chase:
+                    ghost->setState<ChaseState>();
+                    break;
+                case Ghost::State::Frightened:
+                    if (isChaseMode_)
+                        ghost->setState<FrightenedState<ChaseState>>();
+                    else
+                        ghost->setState<FrightenedState<ScatterState>>();
+                    break;
+                case Ghost::State::Eaten:
+                    if (isChaseMode_)
+                        ghost->setState<EatenState>(EatenState::NextState::Chase);
+                    else
+                        ghost->setState<EatenState>(EatenState::NextState::Scatter);
+                    break;
+                default:
+                    ghost->clearState();
+                    break;
+            }
+
+            ghost->setFlattened(ghostState.isFlat);
+            advanceActor(ghost, ghostState);
+
+            restoreTimer(houseArrestTimers_[i], ghostState.houseArrest, [ghost] {
+                ghost->setLockInGhostHouse(false);
+            });
+        }
+
+        for (std::size_t i = 0; i < gridMovers_.size(); ++i) {
+            if (ime::GridObject* actor = gridMovers_[i]->getTarget())
+                previousPositions_[i] = actor->getTransform().getPosition();
+        }
+
+        // Timers
+        restoreTimer(ghostAITimer_, state.ghostAITimer, [this] {
+            if (isChaseMode_)
+                endChaseMode();
+            else
+                endScatterMode();
+        });
+
+        restoreTimer(superModeTimer_, state.superModeTimer, [this] {
+            endSuperMode();
+        });
+
+        restoreTimer(powerModeTimer_, state.powerModeTimer, [this] {
+            endPowerMode();
+        });
+
+        restoreTimer(bonusStageTimer_, state.bonusStageTimer, [this] {
+            getEventEmitter().emit("levelComplete");
+        });
+
+        if (state.starTimer.status != SessionState::Timer::Status::Stopped) {
+            spawnStar();
+            restoreTimer(starTimer_, state.starTimer, [this] {
+                despawnStar();
+            });
+        }
+
+        if (!isBonusStage_) {
+            bool isPowerMode = state.powerModeTimer.status != SessionState::Timer::Status::Stopped;
+            music_.play(isPowerMode ? MusicTrack::Frightened : MusicTrack::Siren);
+        }
+
+        // Restored last, entering the ghost states and spawning the star draw numbers
+        random_.setState(state.randomState);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::rewind(ime::Time duration) {
+        if (services_.rewindBuffer->isEmpty())
+            return;
+
+        auto numTicks = static_cast<std::uint64_t>(duration.asSeconds() * Constants::SIMULATION_TICK_RATE);
+        std::uint64_t tick = std::max(tick_ > numTicks ? tick_ - numTicks : 0, services_.rewindBuffer->getFirstTick());
+
+        SessionState state;
+        if (!services_.rewindBuffer->restore(tick, state))
+            return;
+
+        // Eaten items cannot be put back into this scene, so the rewound session continues in a new one
+        services_.rewindBuffer->truncate(tick);
+        getEngine().popScene();
+        getEngine().pushScene(std::make_unique<GameplayScene>(session_, services_, state, tick));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    SessionState::Timer GameplayScene::captureTimer(const TimerWheel& timers, const TimerHandle& timer) {
+        SessionState::Timer state;
+
+        if (timers.isRunning(timer))
+            state.status = SessionState::Timer::Status::Running;
+        else if (timers.isPaused(timer))
+            state.status = SessionState::Timer::Status::Paused;
+        else
+            return state;
+
+        state.remaining = static_cast<std::int32_t>(timers.getRemainingDuration(timer).asMilliseconds());
+        return state;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::restoreTimer(TimerHandle& timer, const SessionState::Timer& state, ime::Callback<> timeoutCallback) {
+        aiTime_.getTimers().cancel(timer);
+
+        if (state.status == SessionState::Timer::Status::Stopped)
+            return;
+
+        timer = aiTime_.getTimers().schedule(ime::milliseconds(state.remaining), std::move(timeoutCallback));
+
+        if (state.status == SessionState::Timer::Status::Paused)
+            aiTime_.getTimers().pause(timer);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::captureActor(ime::GridObject* actor, SessionState::Actor& state) {
+        const ime::Tile& tile = getGrid().getTileOccupiedByChild(actor);
+        ime::Index index = tile.getIndex();
+        ime::Direction direction = actor->getDirection();
+
+        // Distance travelled past the centre of the tile, in 1/16 pixels
+        ime::Vector2f offset = actor->getTransform().getPosition() - tile.getWorldCentre();
+        long progress = std::lround((offset.x * direction.x + offset.y * direction.y) * 16.0f);
+
+        // An actor that has not reached the centre of its tile yet is recorded on the tile it is leaving
+        if (progress < 0) {
+            index.row -= direction.y;
+            index.colm -= direction.x;
+            progress += static_cast<long>(getGrid().getTileSize().x) * 16;
+        }
+
+        state.isPresent = true;
+        state.row = static_cast<std::int16_t>(index.row);
+        state.colm = static_cast<std::int16_t>(index.colm);
+        state.dirX = static_cast<std::int8_t>(direction.x);
+        state.dirY = static_cast<std::int8_t>(direction.y);
+        state.progress = static_cast<std::uint16_t>(progress);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::placeActor(ime::GridObject* actor, const SessionState::Actor& state) {
+        grid_->removeGameObject(actor);
+        grid_->addGameObject(actor, ime::Index{state.row, state.colm});
+        actor->setDirection(ime::Direction{state.dirX, state.dirY});
+        actor->getSprite().setVisible(true);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::advanceActor(ime::GridObject* actor, const SessionState::Actor& state) {
+        ime::GridMover* gridMover = actor->getGridMover();
+        float speed = gridMover->getSpeed().x * gridMover->getSpeedMultiplier();
+
+        if (state.progress > 0 && speed > 0.0f)
+            gridMover->update(ime::seconds(state.progress / 16.0f / speed));
+    }
+
     ///////////////////////////////////////////////////////////////
     GameplayScene::~GameplayScene() {
+        if (sessionListenerId_ != -1)
+            session_.removeChangeListener(sessionListenerId_);
+
         delete view_;
         ObjectReferenceKeeper::clear();
         Key::resetCounter();
@@ -26,12 +26,31 @@
 #define SUPERPACMAN_GAMEPLAYSCENE_H
 
 #include <IME/core/scene/Scene.h>
+#include <IME/core/physics/grid/GridMover.h>
 #include "Common/Events.h"
+#include "Common/TimeDomain.h"
+#include "Common/FixedTimestep.h"
+#include "Common/Random.h"
+#include "Common/TuningTable.h"
 #include "Grid.h"
+#include "PathFinders/DistanceField.h"
 #include "Views/CommonView.h"
+#include "Views/DigitDisplay.h"
 #include "CollisionResponseRegisterer.h"
+#include "Session/GameSession.h"
+#include "Session/GameServices.h"
+#include "Session/SessionState.h"
+#include "Audio/SfxPlayer.h"
+#include "Audio/MusicLayer.h"
+#include <array>
+#include <future>
+#include <memory>
+#include <optional>
+#include <vector>
 
 namespace spm {
+    class PacManGridMover;
+
     /**
      * @brief Defines the playing state of the game
      */
@@ -39,8 +58,21 @@ namespace spm {
     public:
         /**
          * @brief Constructor
+         * @param session The progress of the player
+         * @param services Objects shared by the gameplay scenes
          */
-        GameplayScene();
+        GameplayScene(GameSession& session, GameServices& services);
+
+        /**
+         * @brief Construct a scene that continues a rewound session
+         * @param session The progress of the player
+         * @param services Objects shared by the gameplay scenes
+         * @param state The state to continue from
+         * @param tick The simulation step @a state was captured on
+         *
+         * The state is restored when the scene is entered
+         */
+        GameplayScene(GameSession& session, GameServices& services, const SessionState& state, std::uint64_t tick);
 
         /**
          * @brief Enter the scene
@@ -77,6 +109,16 @@ namespace spm {
          */
         void onUpdate(ime::Time deltaTime) override;
 
+        /**
+         * @brief Handle a system event
+         * @param event The event to be handled
+         *
+         * This function is called by the game engine before the scene is
+         * updated. It forwards the event to the grid movers owned by
+         * the scene
+         */
+        void onHandleEvent(ime::Event event) override;
+
         /**
          * @brief Handle cache reactivation
          *
@@ -101,6 +143,45 @@ namespace spm {
          */
         void onFrameEnd() override;
 
+        /**
+         * @brief Capture the state of the gameplay session
+         * @param state The object to write the state into
+         * @param captureMaze False to leave the items and doors of @a state unchanged
+         * @return True if the state was captured or false if the session
+         *         is not in a capturable state
+         *
+         * A state can only be captured while the level is being played
+         * normally. It cannot be captured during the level start countdown,
+         * while pacman is dying, while the game is frozen after an actor
+         * was eaten or after the level has been completed
+         *
+         * @see restoreState
+         */
+        bool captureState(SessionState& state, bool captureMaze = true);
+
+        /**
+         * @brief Restore a previously captured gameplay session
+         * @param state The state to be restored
+         *
+         * The scene must have been entered on the same level the state
+         * was captured on. The current session is discarded and play
+         * continues from @a state immediately, without a countdown
+         *
+         * @see captureState
+         */
+        void restoreState(const SessionState& state);
+
+        /**
+         * @brief Go back in time
+         * @param duration How far back to go
+         *
+         * The scene is replaced by one that continues from the recorded
+         * state closest to @a duration ago. If the history does not go
+         * back that far, the session continues from the oldest recorded
+         * state instead
+         */
+        void rewind(ime::Time duration);
+
         /**
          * @brief Destructor
          */
@@ -122,11 +203,72 @@ namespace spm {
          */
         void initGameObjects();
 
+        /**
+         * @brief Create the distance fields shared by the ghosts
+         *
+         * The pacman field is recomputed every time pacman enters a new
+         * tile and the respawn field is computed once since its source
+         * never changes
+         */
+        void initDistanceFields();
+
+        /**
+         * @brief Update the distance fields after a door is opened
+         */
+        void refreshDistanceFields();
+
         /**
          * @brief Create movement controllers for pacman and ghosts
          */
         void initMovementControllers();
 
+        /**
+         * @brief Take ownership of a grid mover
+         * @param gridMover The grid mover to be simulated
+         *
+         * The grid movers are not added to the engine, since the engine
+         * updates them with a variable frame time. They are updated in
+         * fixed steps by spm::GameplayScene::simulate instead
+         */
+        void addGridMover(std::unique_ptr<ime::GridMover> gridMover);
+
+        /**
+         * @brief Advance the gameplay simulation by a single fixed step
+         * @param step The duration of the step
+         */
+        void simulate(ime::Time step);
+
+        /**
+         * @brief Record the state of the session in the rewind buffer
+         *
+         * The items and doors are only captured from the grid on keyframes.
+         * Between keyframes, the recorded state is brought up to date with
+         * the items and doors marked by the collision responses
+         *
+         * @see markItemEaten, markDoorsChanged
+         */
+        void recordState();
+
+        /**
+         * @brief Mark an item as eaten for the next recorded state
+         * @param item The pellet, fruit or key that was eaten
+         */
+        void markItemEaten(ime::GridObject* item);
+
+        /**
+         * @brief Mark the doors as changed for the next recorded state
+         */
+        void markDoorsChanged();
+
+        /**
+         * @brief Place the actor sprites between their last two simulated positions
+         * @param alpha The weight of the latest simulated position
+         *
+         * This keeps motion smooth when the display refreshes at a
+         * different rate than the simulation
+         */
+        void interpolateActors(float alpha);
+
         /**
          * @brief Initialize pacmans collision responses
          *
@@ -191,8 +333,11 @@ namespace spm {
          * @param timer The timer to configure
          * @param duration How long the timer runs before it expires
          * @param timeoutCallback The function to execute when the timer expires
+         *
+         * If @a timer is already running, its remaining duration is extended
+         * by @a duration and @a timeoutCallback is ignored
          */
-        void configureTimer(ime::Timer& timer, ime::Time duration, ime::Callback<> timeoutCallback);
+        void configureTimer(TimerHandle& timer, ime::Time duration, ime::Callback<> timeoutCallback);
 
         /**
          * @brief Transition game to pause menu
@@ -257,6 +402,24 @@ namespace spm {
          */
         void endGameplay();
 
+        /**
+         * @brief Record a telemetry event
+         * @param type The type of the event
+         * @param object The object whose tile the event occurred on, or nullptr if it has no position
+         * @param subject Event specific identifier
+         * @param value Event specific value
+         *
+         * The event is discarded if telemetry is disabled
+         */
+        void recordEvent(TelemetryEventType type, ime::GridObject* object = nullptr, int subject = 0, int value = 0);
+
+        /**
+         * @brief Get the index of a ghost
+         * @param ghost The ghost to get the index of
+         * @return The index of the ghost (Blinky, Pinky, Inky then Clyde)
+         */
+        static int getGhostIndex(const ime::GameObject* ghost);
+
         /**
          * @brief Start the ghost scatter mode timer
          */
@@ -267,6 +430,86 @@ namespace spm {
          */
         void startChaseTimer();
 
+        /**
+         * @brief Advance to the next chase wave
+         *
+         * This function is called when the scatter mode timer expires
+         */
+        void endScatterMode();
+
+        /**
+         * @brief Advance to the next scatter wave
+         *
+         * This function is called when the chase mode timer expires
+         */
+        void endChaseMode();
+
+        /**
+         * @brief Return the ghosts to scatter or chase mode
+         *
+         * This function is called when the power mode timer expires
+         */
+        void endPowerMode();
+
+        /**
+         * @brief Return pacman to his normal state
+         *
+         * This function is called when the super mode timer expires
+         */
+        void endSuperMode();
+
+        /**
+         * @brief Capture the state of a gameplay timer
+         * @param timers The timer wheel the timer is scheduled on
+         * @param timer The timer to be captured
+         * @return The state of the timer
+         */
+        static SessionState::Timer captureTimer(const TimerWheel& timers, const TimerHandle& timer);
+
+        /**
+         * @brief Reschedule a captured gameplay timer
+         * @param timer The timer to be rescheduled
+         * @param state The captured state of the timer
+         * @param timeoutCallback The function to execute when the timer expires
+         */
+        void restoreTimer(TimerHandle& timer, const SessionState::Timer& state, ime::Callback<> timeoutCallback);
+
+        /**
+         * @brief Capture the position and direction of an actor
+         * @param actor The actor to be captured
+         * @param state The object to write the state into
+         */
+        void captureActor(ime::GridObject* actor, SessionState::Actor& state);
+
+        /**
+         * @brief Return an actor to a captured tile
+         * @param actor The actor to be placed
+         * @param state The captured state of the actor
+         */
+        void placeActor(ime::GridObject* actor, const SessionState::Actor& state);
+
+        /**
+         * @brief Capture the items left in the maze
+         * @param state The object to write the items into
+         */
+        void captureItems(SessionState& state);
+
+        /**
+         * @brief Capture the status of the doors
+         * @param state The object to write the doors into
+         */
+        void captureDoors(SessionState& state);
+
+        /**
+         * @brief Move an actor the captured distance towards its next tile
+         * @param actor The actor to be moved
+         * @param state The captured state of the actor
+         *
+         * The actor must have been placed on its tile and must be in its
+         * captured state, since the state determines its speed
+         */
+        void advanceActor(ime::GridObject* actor, const SessionState::Actor& state);
+
         /**
          * @brief Get the duration of the ghosts scatter mode
          * @return Scatter mode duration
@@ -291,6 +534,12 @@ namespace spm {
          */
         ime::Time getSuperModeDuration();
 
+        /**
+         * @brief Get the tuning values of the current level
+         * @return The tuning values of the current level
+         */
+        const LevelTuning& getLevelTuning() const;
+
         /**
          * @brief Pause the scatter-chase transition timer
          */
@@ -307,18 +556,45 @@ namespace spm {
         void stopAllTimers();
 
     private:
+        GameSession& session_;          //!< The progress of the player
+        GameServices& services_;        //!< Tuning, rewind history, telemetry and autopilot of the game
         int currentLevel_;              //!< Current game level
         int pointsMultiplier_;          //!< Ghost points multiplier when player eats ghosts in succession (in one power mode session)
         bool isPaused_;                 //!< A flag indicating whether or not the game is paused
         CommonView* view_;               //!< Scene view without the gameplay grid
+        std::unique_ptr<DigitDisplay> remainingTimeDisplay_; //!< Bonus stage countdown, nullptr if the level is not a bonus stage
         std::unique_ptr<Grid> grid_;    //!< Gameplay grid view
-        ime::Timer ghostAITimer_;       //!< Scatter-chase state transition timer
-        ime::Timer superModeTimer_;     //!< Pacman Super mode duration counter
-        ime::Timer powerModeTimer_;     //!< Energizer mode duration counter
-        ime::Timer starTimer_;          //!< Star appearance timer
-        ime::Timer bonusStageTimer_;    //!< Bonus stage counter
-        ime::audio::Audio* mainAudio_;  //!< Main game audio
-        ime::audio::Audio* starSpawnSfx_; //!< Sound effect played when a star is spawned
+        std::unique_ptr<DistanceField> pacmanDistanceField_;  //!< Distance from every tile to pacman's tile
+        std::unique_ptr<DistanceField> respawnDistanceField_; //!< Distance from every tile to the tile an eaten ghost is revived on
+        TimeDomain gameplayTime_;       //!< Root time domain, runs level sequencing timeouts
+        TimeDomain aiTime_;             //!< Actor movement and mode timers (nested in gameplay time)
+        TimeDomain animationTime_;      //!< Actor animations (nested in gameplay time)
+        TimeDomain hudTime_;            //!< Heads up display
+        FixedTimestep timestep_;        //!< Converts frame times into fixed simulation steps
+        std::vector<std::unique_ptr<ime::GridMover>> gridMovers_; //!< Actor grid movers, updated in fixed steps
+        std::vector<ime::Vector2f> previousPositions_;             //!< Actor positions before the last simulation step
+        std::uint64_t tick_;            //!< Number of simulation steps taken on the level
+        SessionState recordedState_;    //!< State recorded on the last simulation step
+        std::vector<ime::Index> eatenItems_; //!< Tiles of the items eaten since the last recorded state
+        bool areDoorsChanged_;          //!< A flag indicating whether or not a door changed since the last recorded state
+        std::optional<SessionState> pendingState_;   //!< State to be restored when the scene is entered
+        SessionState autopilotState_;                //!< State the autopilot searches from
+        SessionState tracedState_;                   //!< State recorded in the session trace, reused between tiles
+        std::future<Action> autopilotAction_;        //!< Direction the autopilot is choosing for pacman's next tile
+        bool isAutopilotActionStale_;                //!< A flag indicating whether or not the actors were reset during the search
+        PacManGridMover* pacmanGridMover_;           //!< Pacman's grid mover (owned by gridMovers_)
+        int presentedLives_;            //!< The number of lives shown in the HUD
+        int sessionListenerId_;         //!< The id number of the session change listener
+        TimerHandle ghostAITimer_;      //!< Scatter-chase state transition timer
+        TimerHandle superModeTimer_;    //!< Pacman Super mode duration counter
+        TimerHandle powerModeTimer_;    //!< Energizer mode duration counter
+        TimerHandle starTimer_;         //!< Star appearance timer
+        TimerHandle bonusStageTimer_;   //!< Bonus stage counter
+        std::array<TimerHandle, 4> houseArrestTimers_; //!< Ghost house probation timers (Blinky, Pinky, Inky and Clyde)
+        Random random_;                 //!< Source of all randomness in the gameplay
+        MusicLayer music_;              //!< Main game audio
+        SfxPlayer sfx_;                 //!< Plays the gameplay sound effects
+        SfxPlayer::VoiceId starSpawnSfx_; //!< Sound effect played while a star is on screen
         unsigned int scatterWaveLevel_; //!< The current scatter mode level (up to 4 levels)
         unsigned int chaseWaveLevel_;   //!< The current chase mode level (up to 5 levels)
         unsigned int numFruitsEaten_;   //!< The number of fruits eaten so far
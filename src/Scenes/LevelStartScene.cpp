@@ -28,20 +28,18 @@
 
 namespace spm {
     ///////////////////////////////////////////////////////////////
-    LevelStartScene::LevelStartScene() :
+    LevelStartScene::LevelStartScene(GameSession& session) :
+        session_{session},
         view_{nullptr}
     {}
 
     ///////////////////////////////////////////////////////////////
     void LevelStartScene::onEnter() {
         view_ = new LevelStartSceneView(getGui());
-        auto level = getCache().getValue<int>("CURRENT_LEVEL");
-        auto lives = getCache().getValue<int>("PLAYER_LIVES");
-        auto score = getCache().getValue<int>("CURRENT_SCORE");
-        auto highScore = getCache().getValue<int>("HIGH_SCORE");
-        view_->init(level, lives, score, highScore);
+        int level = session_.getLevel();
+        view_->init(level, session_.getLives(), session_.getScore(), session_.getHighScore());
 
-        if (level == getCache().getValue<int>("BONUS_STAGE"))
+        if (level == session_.getNextBonusStage())
             getGui().getWidget<ime::ui::Label>("lblLevel")->setText("BONUS STAGE");
 
         ime::Time sceneDuration = ime::seconds(2);
@@ -49,7 +47,7 @@ namespace spm {
         static bool playedAudio = false;
         if (level == 1 && !playedAudio) {
             playedAudio = true;
-            getAudio().setMasterVolume(getCache().getValue<float>("MASTER_VOLUME"));
+            getAudio().setMasterVolume(session_.getMasterVolume());
             getAudio().play(ime::audio::Type::Sfx, "beginning.wav");
             sceneDuration = ime::seconds(4.2);
         }
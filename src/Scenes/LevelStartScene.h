@@ -27,6 +27,7 @@
 
 #include <IME/core/scene/Scene.h>
 #include "Views/LevelStartSceneView.h"
+#include "Session/GameSession.h"
 
 namespace spm {
     /**
@@ -40,8 +41,9 @@ namespace spm {
     public:
         /**
          * @brief Constructor
+         * @param session The progress of the player
          */
-        LevelStartScene();
+        explicit LevelStartScene(GameSession& session);
 
         /**
          * @brief Enter the scene
@@ -68,6 +70,7 @@ namespace spm {
         ~LevelStartScene() override;
 
     private:
+        GameSession& session_;      //!< The progress of the player
         LevelStartSceneView* view_; //!< View for this state
     };
 }
@@ -44,7 +44,7 @@ namespace spm {
         });
 
         ime::ResourceLoader::loadFromFile(ime::ResourceType::SoundEffect, {
-            "doorBroken.wav", "fruitEaten.wav", "ghostEaten.wav",
+            "doorBroken.wav", "fruitEaten.wav", "ghostEaten.wav", "WakkaWakka.wav", "keyEaten.wav",
             "pacmanDying.wav", "powerPelletEaten.wav", "superPelletEaten.wav",
             "beginning.wav", "levelComplete.ogg", "wieu_wieu_slow.ogg", "extraLife.wav",
             "starSpawned.wav", "bonusFruitMatch.wav", "bonusFruitNotMatch.wav", "ghostsTurnedBlue.wav"
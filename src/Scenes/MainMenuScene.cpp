@@ -35,7 +35,9 @@
 
 namespace spm {
     ///////////////////////////////////////////////////////////////
-    MainMenuScene::MainMenuScene() :
+    MainMenuScene::MainMenuScene(GameSession& session, GameServices& services) :
+        session_{session},
+        services_{services},
         view_{nullptr}
     {}
 
@@ -60,15 +62,13 @@ namespace spm {
         auto levelContainer = getGui().getWidget<ime::ui::VerticalLayout>("vlLevels");
 
         // Replace placeholder text with actual Scoreboard data
-        scoreboard->forEachScore([&, count = 1] (const Score& score) mutable {
-            if (count > NUM_SCORES_TO_DISPLAY)
-                return;
-
+        auto count = 1;
+        for (const auto& score : scoreboard->getScores(0, NUM_SCORES_TO_DISPLAY)) {
             namesContainer->getWidget<ime::ui::Label>("lblEntry" + std::to_string(count))->setText(score.getOwner());
             scoreContainer->getWidget<ime::ui::Label>("lblEntry" + std::to_string(count))->setText(std::to_string(score.getValue()));
             levelContainer->getWidget<ime::ui::Label>("lblEntry" + std::to_string(count))->setText(std::to_string(score.getLevel()));
             count++;
-        });
+        }
     }
 
     ///////////////////////////////////////////////////////////////
@@ -79,11 +79,12 @@ namespace spm {
         }));
 
         getGui().getWidget("btnPlay")->on("click", ime::Callback<>([this] {
-            utils::resetCache(getCache());
             getEngine().uncacheScene("GameplayScene");
+            session_.startNewGame();
+            utils::resetCache(getCache());
             getEngine().popScene();
-            getEngine().pushScene(std::make_unique<GameplayScene>());
-            getEngine().pushScene(std::make_unique<LevelStartScene>());
+            getEngine().pushScene(std::make_unique<GameplayScene>(session_, services_));
+            getEngine().pushScene(std::make_unique<LevelStartScene>(session_));
         }));
 
         getGui().getWidget("btnQuit")->on("click", ime::Callback<>([this] {
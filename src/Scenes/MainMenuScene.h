@@ -26,6 +26,8 @@
 #define SUPERPACMAN_MAINMENUSCENE_H
 
 #include "Views/MainMenuSceneView.h"
+#include "Session/GameSession.h"
+#include "Session/GameServices.h"
 #include <IME/core/scene/Scene.h>
 
 namespace spm {
@@ -41,8 +43,10 @@ namespace spm {
     public:
         /**
          * @brief Constructor
+         * @param session The progress of the player
+         * @param services Objects shared by the gameplay scenes
          */
-        MainMenuScene();
+        MainMenuScene(GameSession& session, GameServices& services);
 
         /**
          * @brief Enter the scene
@@ -85,6 +89,8 @@ namespace spm {
         void initEventHandlers();
 
     private:
+        GameSession& session_;      //!< The progress of the player
+        GameServices& services_;    //!< Handed to the gameplay scenes this scene starts
         MainMenuSceneView* view_;
     };
 }
@@ -28,6 +28,11 @@
 #include <IME/core/engine/Engine.h>
 
 namespace spm {
+    ///////////////////////////////////////////////////////////////
+    PauseMenuScene::PauseMenuScene(GameSession& session) :
+        session_{session}
+    {}
+
     ///////////////////////////////////////////////////////////////
     void PauseMenuScene::onEnter() {
         PauseMenuSceneView::init(getGui());
@@ -52,15 +57,15 @@ namespace spm {
         }));
 
         auto btnOption = getGui().getWidget<ime::ui::ToggleButton>("btnAudioToggle");
-        btnOption->setChecked(getCache().getValue<float>("MASTER_VOLUME") > 0.0f);
+        btnOption->setChecked(session_.getMasterVolume() > 0.0f);
         btnOption->setText(btnOption->isChecked() ? "on" : "off");
 
         getGui().getWidget("btnAudioToggle")->on("toggle", ime::Callback<bool>([this, btnOption](bool checked) {
             if (checked) {
-                getCache().setValue("MASTER_VOLUME", 100.0f);
+                session_.setMasterVolume(100.0f);
                 btnOption->setText("on");
             } else {
-                getCache().setValue("MASTER_VOLUME", 0.0f);
+                session_.setMasterVolume(0.0f);
                 btnOption->setText("off");
             }
         }));
@@ -25,6 +25,7 @@
 #ifndef SUPERPACMAN_PAUSEMENUSCENE_H
 #define SUPERPACMAN_PAUSEMENUSCENE_H
 
+#include "Session/GameSession.h"
 #include <IME/core/scene/Scene.h>
 
 namespace spm {
@@ -33,6 +34,12 @@ namespace spm {
      */
     class PauseMenuScene : public ime::Scene {
     public:
+        /**
+         * @brief Constructor
+         * @param session The progress of the player
+         */
+        explicit PauseMenuScene(GameSession& session);
+
         /**
          * @brief Enter the scene
          *
@@ -46,6 +53,9 @@ namespace spm {
          * @brief Initialize event handlers
          */
         void initEventHandlers();
+
+    private:
+        GameSession& session_; //!< The progress of the player
     };
 }
 
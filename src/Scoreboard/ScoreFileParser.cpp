@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ScoreFileParser.h"
+#include "Common/MappedFile.h"
+#include <algorithm>
+#include <charconv>
+
+namespace spm {
+    namespace {
+        ///////////////////////////////////////////////////////////////
+        bool parseLine(std::string_view line, const ScoreFileParser::Callback& callback) {
+            auto nameEnd = line.find(':');
+            if (nameEnd == std::string_view::npos)
+                return false;
+
+            const char* end = line.data() + line.size();
+            int value = 0;
+            auto [valueEnd, valueError] = std::from_chars(line.data() + nameEnd + 1, end, value);
+            if (valueError != std::errc() || valueEnd == end || *valueEnd != ' ')
+                return false;
+
+            unsigned int level = 0;
+            auto [levelEnd, levelError] = std::from_chars(valueEnd + 1, end, level);
+            if (levelError != std::errc() || levelEnd != end)
+                return false;
+
+            callback(line.substr(0, nameEnd), value, level);
+            return true;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool ScoreFileParser::parseFile(const std::string& filename, ScoreTable& table, std::vector<ScoreFileError>& errors) {
+        MappedFile file;
+        if (!file.open(filename))
+            return false;
+
+        parse(std::string_view(file.getData(), file.getSize()), table, errors);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ScoreFileParser::parse(std::string_view text, ScoreTable& table, std::vector<ScoreFileError>& errors) {
+        auto numLines = static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n')) + 1;
+        table.reserve(table.getSize() + numLines, text.size());
+        parse(text, [&table](std::string_view owner, int value, unsigned int level) {
+            table.add(owner, value, level);
+        }, errors);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ScoreFileParser::parse(std::string_view text, const Callback& callback, std::vector<ScoreFileError>& errors) {
+        std::size_t lineNumber = 0;
+        while (!text.empty()) {
+            auto lineEnd = text.find('\n');
+            auto line = text.substr(0, lineEnd);
+            text.remove_prefix(lineEnd == std::string_view::npos ? text.size() : lineEnd + 1);
+            lineNumber++;
+
+            if (!line.empty() && line.back() == '\r')
+                line.remove_suffix(1);
+
+            if (!line.empty() && !parseLine(line, callback))
+                errors.push_back({lineNumber, std::string(line)});
+        }
+    }
+
+} // namespace spm
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_SCOREFILEPARSER_H
+#define SUPERPACMAN_SCOREFILEPARSER_H
+
+#include "ScoreTable.h"
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief A line of a high scores file that could not be parsed
+     */
+    struct ScoreFileError {
+        std::size_t line;  //!< Line number, starting at 1
+        std::string text;  //!< The contents of the line
+    };
+
+    /**
+     * @brief Reads high score files
+     *
+     * Each line of a high scores file holds a single score in the format
+     * "name:score level", for example "Kyle Jenkins:55000 9". Empty lines
+     * are ignored
+     */
+    class ScoreFileParser {
+    public:
+        using Callback = std::function<void(std::string_view owner, int value, unsigned int level)>;
+
+        /**
+         * @brief Read a high scores file
+         * @param filename The name of the file preceded by its path
+         * @param table The table to add the scores to
+         * @param errors The list to add malformed lines to
+         * @return True if the file was read or false if it could not be opened
+         *
+         * The file is mapped into memory and parsed in place, malformed lines
+         * are skipped
+         */
+        static bool parseFile(const std::string& filename, ScoreTable& table, std::vector<ScoreFileError>& errors);
+
+        /**
+         * @brief Parse the contents of a high scores file
+         * @param text The contents of the file
+         * @param table The table to add the scores to
+         * @param errors The list to add malformed lines to
+         */
+        static void parse(std::string_view text, ScoreTable& table, std::vector<ScoreFileError>& errors);
+
+        /**
+         * @brief Parse the contents of a high scores file without storing them
+         * @param text The contents of the file
+         * @param callback Function called with each score, in file order
+         * @param errors The list to add malformed lines to
+         *
+         * The owner passed to @a callback refers to @a text
+         */
+        static void parse(std::string_view text, const Callback& callback, std::vector<ScoreFileError>& errors);
+    };
+}
+
+#endif
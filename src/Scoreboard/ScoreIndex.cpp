@@ -0,0 +1,287 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "ScoreIndex.h"
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+namespace spm {
+    namespace {
+        ///////////////////////////////////////////////////////////////
+        std::uint32_t getPriority(std::uint32_t index) {
+            // Any well mixed function of the index keeps the treap balanced in expectation
+            index ^= index >> 16;
+            index *= 0x7feb352du;
+            index ^= index >> 15;
+            index *= 0x846ca68bu;
+            index ^= index >> 16;
+            return index;
+        }
+
+        ///////////////////////////////////////////////////////////////
+        bool isRankedBefore(const ScoreTable& table, std::uint32_t lhs, std::uint32_t rhs) {
+            int lhsValue = table.getValue(lhs);
+            int rhsValue = table.getValue(rhs);
+            return lhsValue > rhsValue || (lhsValue == rhsValue && lhs < rhs);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    ScoreIndex::ScoreIndex(const ScoreTable& table) :
+        table_{table}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void ScoreIndex::rebuild() {
+        clear();
+        auto ranking = std::vector<std::uint32_t>(table_.getSize());
+        std::iota(ranking.begin(), ranking.end(), 0);
+        std::stable_sort(ranking.begin(), ranking.end(), [this](std::uint32_t lhs, std::uint32_t rhs) {
+            return table_.getValue(lhs) > table_.getValue(rhs);
+        });
+
+        // Visiting the scores in rank order keeps the other indexes sorted without searching
+        auto levelRankings = std::map<unsigned int, std::vector<std::uint32_t>>();
+        for (auto index : ranking) {
+            levelRankings[table_.getLevel(index)].push_back(index);
+            bestScores_.emplace(table_.getOwner(index), index);
+        }
+
+        ranking_.assign(ranking);
+        for (const auto& [level, levelRanking] : levelRankings)
+            levelRankings_[level].assign(levelRanking);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ScoreIndex::add(std::size_t index) {
+        assert(ranking_.getSize() == index && "Scores must be indexed in the order they are added to the table");
+        auto scoreIndex = static_cast<std::uint32_t>(index);
+        ranking_.insert(table_, scoreIndex);
+        levelRankings_[table_.getLevel(index)].insert(table_, scoreIndex);
+
+        auto owner = table_.getOwner(index);
+        auto best = bestScores_.find(owner);
+        if (best == bestScores_.end())
+            bestScores_.emplace(owner, scoreIndex);
+        else if (table_.getValue(index) > table_.getValue(best->second))
+            best->second = scoreIndex;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ScoreIndex::clear() {
+        ranking_.clear();
+        levelRankings_.clear();
+        bestScores_.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t ScoreIndex::getSize() const {
+        return ranking_.getSize();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t ScoreIndex::getRank(int value) const {
+        return ranking_.countHigher(table_, value) + 1;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::vector<std::size_t> ScoreIndex::getRange(std::size_t offset, std::size_t count) const {
+        return ranking_.slice(offset, count);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::vector<std::size_t> ScoreIndex::getTopScores(unsigned int level, std::size_t count) const {
+        auto levelRanking = levelRankings_.find(level);
+        if (levelRanking == levelRankings_.end())
+            return {};
+
+        return levelRanking->second.slice(0, count);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool ScoreIndex::getBestScore(std::string_view owner, std::size_t& index) const {
+        auto best = bestScores_.find(owner);
+        if (best == bestScores_.end())
+            return false;
+
+        index = best->second;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::vector<std::size_t> ScoreIndex::getRanking() const {
+        return ranking_.slice(0, ranking_.getSize());
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ScoreIndex::Ranking::assign(const std::vector<std::uint32_t>& indexes) {
+        clear();
+        nodes_.reserve(indexes.size());
+
+        // Sorted scores form a treap bottom up (a Cartesian tree on their priorities).
+        // A node leaves the right spine once its subtree is complete
+        auto spine = std::vector<std::int32_t>();
+        for (auto index : indexes) {
+            auto node = static_cast<std::int32_t>(nodes_.size());
+            nodes_.push_back(Node{index, getPriority(index), 1, None, None});
+
+            std::int32_t last = None;
+            while (!spine.empty() && nodes_[spine.back()].priority < nodes_[node].priority) {
+                last = spine.back();
+                spine.pop_back();
+                updateSize(last);
+            }
+
+            nodes_[node].left = last;
+            if (!spine.empty())
+                nodes_[spine.back()].right = node;
+
+            spine.push_back(node);
+        }
+
+        for (auto node = spine.rbegin(); node != spine.rend(); ++node)
+            updateSize(*node);
+
+        root_ = spine.empty() ? None : spine.front();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ScoreIndex::Ranking::insert(const ScoreTable& table, std::uint32_t index) {
+        auto node = static_cast<std::int32_t>(nodes_.size());
+        nodes_.push_back(Node{index, getPriority(index), 1, None, None});
+
+        std::int32_t left, right;
+        split(table, root_, index, left, right);
+        root_ = merge(merge(left, node), right);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t ScoreIndex::Ranking::countHigher(const ScoreTable& table, int value) const {
+        std::size_t count = 0;
+        std::int32_t node = root_;
+        while (node != None) {
+            if (table.getValue(nodes_[node].index) > value) {
+                count += getSize(nodes_[node].left) + 1;
+                node = nodes_[node].right;
+            } else
+                node = nodes_[node].left;
+        }
+
+        return count;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::vector<std::size_t> ScoreIndex::Ranking::slice(std::size_t offset, std::size_t count) const {
+        offset = std::min(offset, nodes_.size());
+        count = std::min(count, nodes_.size() - offset);
+
+        auto scores = std::vector<std::size_t>();
+        scores.reserve(count);
+        collect(root_, offset, count, scores);
+        return scores;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t ScoreIndex::Ranking::getSize() const {
+        return nodes_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ScoreIndex::Ranking::clear() {
+        nodes_.clear();
+        root_ = None;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint32_t ScoreIndex::Ranking::getSize(std::int32_t node) const {
+        return node == None ? 0 : nodes_[node].size;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ScoreIndex::Ranking::updateSize(std::int32_t node) {
+        nodes_[node].size = getSize(nodes_[node].left) + getSize(nodes_[node].right) + 1;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ScoreIndex::Ranking::split(const ScoreTable& table, std::int32_t node, std::uint32_t index, std::int32_t& left, std::int32_t& right) {
+        if (node == None) {
+            left = right = None;
+            return;
+        }
+
+        if (isRankedBefore(table, nodes_[node].index, index)) {
+            split(table, nodes_[node].right, index, nodes_[node].right, right);
+            left = node;
+        } else {
+            split(table, nodes_[node].left, index, left, nodes_[node].left);
+            right = node;
+        }
+
+        updateSize(node);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::int32_t ScoreIndex::Ranking::merge(std::int32_t left, std::int32_t right) {
+        if (left == None)
+            return right;
+        else if (right == None)
+            return left;
+
+        if (nodes_[left].priority > nodes_[right].priority) {
+            nodes_[left].right = merge(nodes_[left].right, right);
+            updateSize(left);
+            return left;
+        } else {
+            nodes_[right].left = merge(left, nodes_[right].left);
+            updateSize(right);
+            return right;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ScoreIndex::Ranking::collect(std::int32_t node, std::size_t& skip, std::size_t& count, std::vector<std::size_t>& scores) const {
+        if (node == None || count == 0)
+            return;
+
+        // Subtrees that are skipped entirely are not visited
+        std::size_t leftSize = getSize(nodes_[node].left);
+        if (skip >= leftSize)
+            skip -= leftSize;
+        else
+            collect(nodes_[node].left, skip, count, scores);
+
+        if (count == 0)
+            return;
+
+        if (skip > 0)
+            skip--;
+        else {
+            scores.push_back(nodes_[node].index);
+            count--;
+        }
+
+        collect(nodes_[node].right, skip, count, scores);
+    }
+
+} // namespace spm
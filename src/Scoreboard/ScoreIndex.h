@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_SCOREINDEX_H
+#define SUPERPACMAN_SCOREINDEX_H
+
+#include "ScoreTable.h"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Secondary indexes over a score table
+     *
+     * The index keeps the scores of a table ranked in descending order,
+     * overall and per level, along with the best score of each player.
+     * Scores with the same value are ranked in the order in which they
+     * were recorded. The rankings are order statistic trees, so indexing
+     * a score and looking up a rank take logarithmic time and getting a
+     * range of ranks takes logarithmic time plus the size of the range
+     */
+    class ScoreIndex {
+    public:
+        /**
+         * @brief Constructor
+         * @param table The table to be indexed
+         *
+         * The table must outlive the index
+         */
+        explicit ScoreIndex(const ScoreTable& table);
+
+        /**
+         * @brief Index every score in the table
+         *
+         * Existing indexes are discarded
+         */
+        void rebuild();
+
+        /**
+         * @brief Index a score that was added to the table
+         * @param index The index of the score in the table
+         *
+         * Scores must be indexed in the order in which they were added
+         */
+        void add(std::size_t index);
+
+        /**
+         * @brief Remove all scores from the index
+         */
+        void clear();
+
+        /**
+         * @brief Get the number of indexed scores
+         * @return The number of indexed scores
+         */
+        std::size_t getSize() const;
+
+        /**
+         * @brief Get the rank of a score value
+         * @param value The value to get the rank of
+         * @return The number of indexed scores higher than @a value plus one
+         */
+        std::size_t getRank(int value) const;
+
+        /**
+         * @brief Get the scores in a range of ranks
+         * @param offset The number of scores to skip, starting from the highest
+         * @param count The maximum number of scores to get
+         * @return The table indexes of the scores, in descending order
+         */
+        std::vector<std::size_t> getRange(std::size_t offset, std::size_t count) const;
+
+        /**
+         * @brief Get the highest scores obtained on a level
+         * @param level The level to get the scores of
+         * @param count The maximum number of scores to get
+         * @return The table indexes of the scores, in descending order
+         */
+        std::vector<std::size_t> getTopScores(unsigned int level, std::size_t count) const;
+
+        /**
+         * @brief Get the best score of a player
+         * @param owner The name of the player
+         * @param index Set to the table index of the best score
+         * @return True if the player has a score, otherwise false
+         */
+        bool getBestScore(std::string_view owner, std::size_t& index) const;
+
+        /**
+         * @brief Get every score in descending order
+         * @return The table indexes of every indexed score
+         */
+        std::vector<std::size_t> getRanking() const;
+
+    private:
+        /**
+         * @brief Scores in descending order, stored as a treap with subtree sizes
+         *
+         * The nodes are kept in a pool and refer to each other by position
+         * in the pool, so that a ranking can grow without a node allocation
+         * per score
+         */
+        class Ranking {
+        public:
+            /**
+             * @brief Replace the scores of the ranking
+             * @param indexes The table indexes of the scores, in descending order
+             *
+             * The tree is built in linear time
+             */
+            void assign(const std::vector<std::uint32_t>& indexes);
+
+            /**
+             * @brief Insert a score
+             * @param table The table the score belongs to
+             * @param index The index of the score in the table
+             *
+             * The score is ranked after the existing scores of the same value
+             */
+            void insert(const ScoreTable& table, std::uint32_t index);
+
+            /**
+             * @brief Get the number of scores higher than a value
+             * @param table The table the scores belong to
+             * @param value The value to compare the scores against
+             * @return The number of scores higher than @a value
+             */
+            std::size_t countHigher(const ScoreTable& table, int value) const;
+
+            /**
+             * @brief Get the scores in a range of ranks
+             * @param offset The number of scores to skip, starting from the highest
+             * @param count The maximum number of scores to get
+             * @return The table indexes of the scores, in descending order
+             */
+            std::vector<std::size_t> slice(std::size_t offset, std::size_t count) const;
+
+            /**
+             * @brief Get the number of scores in the ranking
+             * @return The number of scores
+             */
+            std::size_t getSize() const;
+
+            /**
+             * @brief Remove all scores
+             */
+            void clear();
+
+        private:
+            static constexpr std::int32_t None = -1;
+
+            /**
+             * @brief A score in the ranking
+             */
+            struct Node {
+                std::uint32_t index;       //!< The index of the score in the table
+                std::uint32_t priority;    //!< Heap priority, derived from the index
+                std::uint32_t size;        //!< The number of scores in the subtree
+                std::int32_t left;         //!< Higher ranked scores
+                std::int32_t right;        //!< Lower ranked scores
+            };
+
+            /**
+             * @brief Get the number of scores in a subtree
+             * @param node The root of the subtree
+             * @return The size of the subtree
+             */
+            std::uint32_t getSize(std::int32_t node) const;
+
+            /**
+             * @brief Recompute the size of a node from its children
+             * @param node The node to be updated
+             */
+            void updateSize(std::int32_t node);
+
+            /**
+             * @brief Split a subtree around a score
+             * @param table The table the scores belong to
+             * @param node The root of the subtree
+             * @param index The score to split around
+             * @param left Set to the scores ranked before @a index
+             * @param right Set to the scores ranked after @a index
+             */
+            void split(const ScoreTable& table, std::int32_t node, std::uint32_t index, std::int32_t& left, std::int32_t& right);
+
+            /**
+             * @brief Join two subtrees
+             * @param left The higher ranked subtree
+             * @param right The lower ranked subtree
+             * @return The root of the joined subtree
+             */
+            std::int32_t merge(std::int32_t left, std::int32_t right);
+
+            /**
+             * @brief Append the scores of a subtree to a range
+             * @param node The root of the subtree
+             * @param skip The number of scores still to be skipped
+             * @param count The number of scores still to be appended
+             * @param scores The range to append the scores to
+             */
+            void collect(std::int32_t node, std::size_t& skip, std::size_t& count, std::vector<std::size_t>& scores) const;
+
+        private:
+            std::vector<Node> nodes_;      //!< Node pool
+            std::int32_t root_ = None;     //!< The root of the tree
+        };
+
+    private:
+        const ScoreTable& table_;                                        //!< The indexed scores
+        Ranking ranking_;                                                //!< Every score in descending order
+        std::map<unsigned int, Ranking> levelRankings_;                  //!< The scores of each level in descending order
+        std::map<std::string, std::uint32_t, std::less<>> bestScores_;   //!< The best score of each player
+    };
+}
+
+#endif
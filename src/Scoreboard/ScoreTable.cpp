@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ScoreTable.h"
+#include <cassert>
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    ScoreTable::ScoreTable() :
+        ownerOffsets_{0}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void ScoreTable::reserve(std::size_t numScores, std::size_t ownersSize) {
+        owners_.reserve(ownersSize);
+        ownerOffsets_.reserve(numScores + 1);
+        values_.reserve(numScores);
+        levels_.reserve(numScores);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t ScoreTable::add(std::string_view owner, int value, unsigned int level) {
+        owners_.append(owner);
+        ownerOffsets_.push_back(static_cast<std::uint32_t>(owners_.size()));
+        values_.push_back(value);
+        levels_.push_back(level);
+        return values_.size() - 1;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t ScoreTable::add(const Score& score) {
+        return add(score.getOwner(), score.getValue(), score.getLevel());
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t ScoreTable::getSize() const {
+        return values_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::string_view ScoreTable::getOwner(std::size_t index) const {
+        assert(index < values_.size() && "Score index out of range");
+        return std::string_view(owners_).substr(ownerOffsets_[index], ownerOffsets_[index + 1] - ownerOffsets_[index]);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int ScoreTable::getValue(std::size_t index) const {
+        assert(index < values_.size() && "Score index out of range");
+        return values_[index];
+    }
+
+    ///////////////////////////////////////////////////////////////
+    unsigned int ScoreTable::getLevel(std::size_t index) const {
+        assert(index < levels_.size() && "Score index out of range");
+        return levels_[index];
+    }
+
+    ///////////////////////////////////////////////////////////////
+    Score ScoreTable::getScore(std::size_t index) const {
+        auto score = Score();
+        score.setOwner(std::string(getOwner(index)));
+        score.setValue(getValue(index));
+        score.setLevel(getLevel(index));
+        return score;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ScoreTable::clear() {
+        owners_.clear();
+        ownerOffsets_.assign(1, 0);
+        values_.clear();
+        levels_.clear();
+    }
+
+} // namespace spm
@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_SCORETABLE_H
+#define SUPERPACMAN_SCORETABLE_H
+
+#include "Score.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Compact storage for a large number of scores
+     *
+     * Scores are stored column by column: the names of all owners are
+     * kept back to back in a single string, and values and levels in
+     * separate arrays. Scores are identified by the order in which they
+     * were added
+     */
+    class ScoreTable {
+    public:
+        /**
+         * @brief Constructor
+         */
+        ScoreTable();
+
+        /**
+         * @brief Reserve memory for scores
+         * @param numScores The number of scores to reserve memory for
+         * @param ownersSize The total length of their owners names
+         */
+        void reserve(std::size_t numScores, std::size_t ownersSize);
+
+        /**
+         * @brief Add a score to the table
+         * @param owner The name of the player the score belongs to
+         * @param value The value of the score
+         * @param level The level the score was obtained on
+         * @return The index of the added score
+         */
+        std::size_t add(std::string_view owner, int value, unsigned int level);
+
+        /**
+         * @brief Add a score to the table
+         * @param score The score to be added
+         * @return The index of the added score
+         */
+        std::size_t add(const Score& score);
+
+        /**
+         * @brief Get the number of scores in the table
+         * @return The number of scores in the table
+         */
+        std::size_t getSize() const;
+
+        /**
+         * @brief Get the name of the player a score belongs to
+         * @param index The index of the score
+         * @return The name of the player
+         *
+         * The name is invalidated when a score is added to the table
+         */
+        std::string_view getOwner(std::size_t index) const;
+
+        /**
+         * @brief Get the value of a score
+         * @param index The index of the score
+         * @return The value of the score
+         */
+        int getValue(std::size_t index) const;
+
+        /**
+         * @brief Get the level a score was obtained on
+         * @param index The index of the score
+         * @return The level the score was obtained on
+         */
+        unsigned int getLevel(std::size_t index) const;
+
+        /**
+         * @brief Get a score
+         * @param index The index of the score
+         * @return A copy of the score
+         */
+        Score getScore(std::size_t index) const;
+
+        /**
+         * @brief Remove all scores from the table
+         */
+        void clear();
+
+    private:
+        std::string owners_;                      //!< The names of the owners, back to back
+        std::vector<std::uint32_t> ownerOffsets_; //!< Start of each name in owners_, followed by the end of the last one
+        std::vector<int> values_;                 //!< Score values
+        std::vector<unsigned int> levels_;        //!< Levels the scores were obtained on
+    };
+}
+
+#endif
@@ -23,63 +23,231 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Scoreboard.h"
-#include <IME/utility/DiskFileReader.h>
+#include "Common/MappedFile.h"
+#include "Common/FileLock.h"
 #include <algorithm>
+#include <cassert>
+#include <filesystem>
+#include <fstream>
 
 namespace spm {
+    namespace {
+        ///////////////////////////////////////////////////////////////
+        // The file is sorted once the unsorted scores exceed this many or a quarter of all scores
+        const std::size_t MIN_COMPACTION_THRESHOLD = 64;
+
+        ///////////////////////////////////////////////////////////////
+        std::string getLockFile(const std::string& filename) {
+            return filename + ".lock";
+        }
+
+        ///////////////////////////////////////////////////////////////
+        std::uintmax_t getFileSize(const std::string& filename) {
+            auto error = std::error_code();
+            return std::filesystem::file_size(filename, error);
+        }
+
+        ///////////////////////////////////////////////////////////////
+        std::filesystem::file_time_type getWriteTime(const std::string& filename) {
+            auto error = std::error_code();
+            return std::filesystem::last_write_time(filename, error);
+        }
+
+        ///////////////////////////////////////////////////////////////
+        void writeScore(std::ostream& stream, const ScoreTable& table, std::size_t index) {
+            stream << table.getOwner(index) << ':' << table.getValue(index) << ' ' << table.getLevel(index) << '\n';
+        }
+
+        ///////////////////////////////////////////////////////////////
+        std::vector<Score> getScores(const ScoreTable& table, const std::vector<std::size_t>& indexes) {
+            auto scores = std::vector<Score>();
+            scores.reserve(indexes.size());
+            for (auto index : indexes)
+                scores.push_back(table.getScore(index));
+
+            return scores;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////
     Scoreboard::Scoreboard(const std::string &filename) :
+        index_{highScores_},
+        numSaved_{0},
+        numUnsorted_{0},
+        isNewlineNeeded_{false},
+        fileSize_{static_cast<std::uintmax_t>(-1)},
         highScoresFile_(filename)
     {}
 
     ///////////////////////////////////////////////////////////////
-    void Scoreboard::load() {
-        auto highScores = std::stringstream();
-        ime::utility::DiskFileReader().readFileInto(highScoresFile_, highScores);
-        auto line = std::string();
-        while (std::getline(highScores, line)) {
-            auto posOfSpaceBetweenNameAndScore = line.find_first_of(':');
-            auto scoreAndLevel = line.substr(posOfSpaceBetweenNameAndScore + 1);
-            auto posOfSpaceBetweenScoreAndLevel = scoreAndLevel.find_first_of(' ');
-            auto score = Score();
-            score.setOwner(line.substr(0, posOfSpaceBetweenNameAndScore));
-            score.setValue(std::stoi(line.substr(posOfSpaceBetweenNameAndScore + 1, posOfSpaceBetweenScoreAndLevel)));
-            score.setLevel(std::stoi(scoreAndLevel.substr(posOfSpaceBetweenScoreAndLevel + 1)));
-            highScores_.push_back(score);
+    bool Scoreboard::load() {
+        // Reading without the lock is still possible, but a line that is being appended may be seen half written
+        auto lock = FileLock();
+        lock.lock(getLockFile(highScoresFile_));
+
+        auto file = MappedFile();
+        if (!file.open(highScoresFile_))
+            return false;
+
+        read(std::string_view(file.getData(), file.getSize()));
+        rememberFileState();
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Scoreboard::read(std::string_view text) {
+        highScores_.clear();
+        malformedLines_.clear();
+        ScoreFileParser::parse(text, highScores_, malformedLines_);
+        isNewlineNeeded_ = !text.empty() && text.back() != '\n';
+
+        // Scores after the first out of order one were appended since the file was last sorted
+        numUnsorted_ = 0;
+        for (std::size_t i = 1; i < highScores_.getSize(); ++i) {
+            if (numUnsorted_ > 0 || highScores_.getValue(i - 1) < highScores_.getValue(i))
+                numUnsorted_++;
         }
+
+        index_.rebuild();
+        numSaved_ = highScores_.getSize();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Scoreboard::merge() {
+        auto file = MappedFile();
+        if (!file.open(highScoresFile_) && std::filesystem::exists(highScoresFile_))
+            return false;
+
+        auto unsaved = ScoreTable();
+        for (auto i = numSaved_; i < highScores_.getSize(); ++i)
+            unsaved.add(highScores_.getOwner(i), highScores_.getValue(i), highScores_.getLevel(i));
+
+        read(std::string_view(file.getData(), file.getSize()));
+        for (std::size_t i = 0; i < unsaved.getSize(); ++i)
+            index_.add(highScores_.add(unsaved.getOwner(i), unsaved.getValue(i), unsaved.getLevel(i)));
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Scoreboard::isFileChanged() const {
+        return getFileSize(highScoresFile_) != fileSize_ || getWriteTime(highScoresFile_) != fileWriteTime_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Scoreboard::rememberFileState() {
+        fileSize_ = getFileSize(highScoresFile_);
+        fileWriteTime_ = getWriteTime(highScoresFile_);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const std::vector<ScoreFileError>& Scoreboard::getMalformedLines() const {
+        return malformedLines_;
     }
 
     ///////////////////////////////////////////////////////////////
     void Scoreboard::addScore(const Score &score) {
-        highScores_.push_back(score);
-        std::sort(std::begin(highScores_), std::end(highScores_),std::greater<>());
+        index_.add(highScores_.add(score));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    Score Scoreboard::getTopScore() const {
+        assert(index_.getSize() > 0 && "The scoreboard is empty");
+        return highScores_.getScore(index_.getRange(0, 1).front());
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t Scoreboard::getRank(int value) const {
+        return index_.getRank(value);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::vector<Score> Scoreboard::getScores(std::size_t offset, std::size_t count) const {
+        return spm::getScores(highScores_, index_.getRange(offset, count));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::vector<Score> Scoreboard::getTopScores(unsigned int level, std::size_t count) const {
+        return spm::getScores(highScores_, index_.getTopScores(level, count));
     }
 
     ///////////////////////////////////////////////////////////////
-    const Score& Scoreboard::getTopScore() const {
-        return highScores_.front();
+    std::optional<Score> Scoreboard::getBestScore(const std::string& owner) const {
+        auto index = std::size_t{0};
+        if (!index_.getBestScore(owner, index))
+            return std::nullopt;
+
+        return highScores_.getScore(index);
     }
 
     ///////////////////////////////////////////////////////////////
     std::size_t Scoreboard::getSize() const {
-        return highScores_.size();
+        return highScores_.getSize();
     }
 
     ///////////////////////////////////////////////////////////////
-    void Scoreboard::updateHighScoreFile() {
-        auto newHighscoreList = std::stringstream();
-        newHighscoreList << highScores_.front().getOwner() + ":" + std::to_string(highScores_.front().getValue()) + " " + std::to_string(highScores_.front().getLevel());
-        std::for_each(++highScores_.begin(), highScores_.end(),[&](auto& score) {
-            newHighscoreList << "\n" + score.getOwner() + ":" + std::to_string(score.getValue()) + " " + std::to_string(score.getLevel());
-        });
+    bool Scoreboard::updateHighScoreFile() {
+        if (numSaved_ == highScores_.getSize())
+            return true;
+
+        auto lock = FileLock();
+        if (!lock.lock(getLockFile(highScoresFile_)))
+            return false;
+
+        // Another instance wrote to the file since this one last did
+        if (isFileChanged() && !merge())
+            return false;
+
+        auto numUnsorted = numUnsorted_ + (highScores_.getSize() - numSaved_);
+        if (numUnsorted >= std::max(MIN_COMPACTION_THRESHOLD, highScores_.getSize() / 4))
+            return compact();
+
+        auto file = std::ofstream(highScoresFile_, std::ios::app | std::ios::binary);
+        if (isNewlineNeeded_)
+            file << '\n';
+
+        for (std::size_t i = numSaved_; i < highScores_.getSize(); ++i)
+            writeScore(file, highScores_, i);
+
+        file.close();
+        if (!file)
+            return false;
+
+        isNewlineNeeded_ = false;
+        numSaved_ = highScores_.getSize();
+        numUnsorted_ = numUnsorted;
+        rememberFileState();
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Scoreboard::compact() {
+        auto tempFile = highScoresFile_ + ".tmp";
+        auto file = std::ofstream(tempFile, std::ios::trunc | std::ios::binary);
+        for (auto index : index_.getRanking())
+            writeScore(file, highScores_, index);
+
+        file.close();
+        auto error = std::error_code();
+        if (file)
+            std::filesystem::rename(tempFile, highScoresFile_, error); // Replaces the old file atomically
+
+        if (!file || error) {
+            std::filesystem::remove(tempFile, error);
+            return false;
+        }
 
-        ime::utility::DiskFileReader().writeToFile(newHighscoreList, highScoresFile_);
+        isNewlineNeeded_ = false;
+        numSaved_ = highScores_.getSize();
+        numUnsorted_ = 0;
+        rememberFileState();
+        return true;
     }
 
     ///////////////////////////////////////////////////////////////
     void Scoreboard::forEachScore(std::function<void(const Score&)> callback) {
-        for (const auto& score : highScores_)
-            callback(score);
+        for (auto index : index_.getRanking())
+            callback(highScores_.getScore(index));
     }
 
 } // namespace spm
@@ -26,13 +26,30 @@
 #define SUPERPACMAN_SCOREBOARD_H
 
 #include "Score.h"
+#include "ScoreTable.h"
+#include "ScoreIndex.h"
+#include "ScoreFileParser.h"
+#include <cstdint>
 #include <vector>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <filesystem>
 #include <functional>
 
 namespace spm {
     /**
      * @brief Loads and persists game top scores
+     *
+     * The scoreboard keeps every score it has ever recorded, ranked overall,
+     * per level and per player, so that queries take logarithmic time. New
+     * scores are appended to the end of the high scores file, and the file
+     * is rewritten in descending order once enough unsorted scores have
+     * accumulated
+     *
+     * Several instances of the game may share the same high scores file.
+     * Reads and writes are serialized with an advisory lock, and scores
+     * written by other instances are merged in before the file is updated
      */
     class Scoreboard {
     public:
@@ -44,21 +61,43 @@ namespace spm {
          */
         explicit Scoreboard(const std::string &filename);
 
+        /**
+         * @brief Copy constructor
+         */
+        Scoreboard(const Scoreboard&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        Scoreboard& operator=(const Scoreboard&) = delete;
+
         /**
          * @brief Load high scores from the disk
-         * @throws FileNotFound If the file cannot be found on the disk
+         * @return True if the file was loaded or false if it could not be opened
          *
          * The high scores will be loaded from the file provided during
-         * instantiation
+         * instantiation, replacing the scores in the scoreboard. Malformed
+         * lines are skipped. Scores that have not been written to the file
+         * are discarded
+         *
+         * @see getMalformedLines
+         */
+        bool load();
+
+        /**
+         * @brief Get the lines that could not be parsed by the last load
+         * @return The malformed lines of the high scores file
+         *
+         * Malformed lines are dropped the next time the file is sorted
          */
-        void load();
+        const std::vector<ScoreFileError>& getMalformedLines() const;
 
         /**
          * @brief Add a score to the scoreboard
          * @param score Score to be added
          *
-         * The scoreboard is updated after the score is added. In addition,
-         * note that the scoreboard sorts entries in descending order
+         * The score is written to the disk on the next call to
+         * spm::Scoreboard::updateHighScoreFile
          */
         void addScore(const Score &score);
 
@@ -66,34 +105,109 @@ namespace spm {
          * @brief Get the highest score
          * @return Highest score
          */
-        const Score& getTopScore() const;
+        Score getTopScore() const;
 
         /**
-         * @brief Get the number of top scores in the scoreboard
-         * @return The number of top scores in the scoreboard
+         * @brief Get the rank a score would have on the scoreboard
+         * @param value The value of the score
+         * @return The number of recorded scores higher than @a value plus one
+         */
+        std::size_t getRank(int value) const;
+
+        /**
+         * @brief Get a page of the scoreboard
+         * @param offset The number of scores to skip, starting from the highest
+         * @param count The maximum number of scores to get
+         * @return The scores in the page, in descending order
+         */
+        std::vector<Score> getScores(std::size_t offset, std::size_t count) const;
+
+        /**
+         * @brief Get the highest scores obtained on a level
+         * @param level The level the scores were obtained on
+         * @param count The maximum number of scores to get
+         * @return The scores, in descending order
+         */
+        std::vector<Score> getTopScores(unsigned int level, std::size_t count) const;
+
+        /**
+         * @brief Get the best score of a player
+         * @param owner The name of the player
+         * @return The best score of the player if they have one
+         */
+        std::optional<Score> getBestScore(const std::string& owner) const;
+
+        /**
+         * @brief Get the number of scores in the scoreboard
+         * @return The number of scores in the scoreboard
          */
         std::size_t getSize() const;
 
         /**
          * @brief Write scores to a file on the disk
-         * @param name Name of the player the current score belongs to
-         * @param level The level the player is on when score is saved
+         * @return True if the scores were written, otherwise false
          *
-         * This function will write the current top scores to the file
-         * provided during instantiation. The file is updated only if
-         * the current score is greater than the lowest high score from
-         * the last file read
+         * If the file was modified by another instance since it was last
+         * read or written, it is read again and the scores it contains
+         * replace the saved scores in the scoreboard, so that no instance
+         * overwrites the scores of another. The scores added since the
+         * last update are then appended to the file
+         * provided during instantiation. When too many unsorted scores have
+         * been appended, the whole file is rewritten in descending order
+         * instead. The rewritten file replaces the old one in a single step,
+         * so the file is never left half written
          */
-        void updateHighScoreFile();
+        bool updateHighScoreFile();
 
         /**
          * @brief Execute a function for each score in the scoreboard
          * @param callback Function to be executed
+         *
+         * The scores are visited in descending order
          */
         void forEachScore(std::function<void(const Score&)> callback);
 
     private:
-        std::vector<Score> highScores_; //!< High scores read from dis
+        /**
+         * @brief Replace the scores in the scoreboard with the contents of a file
+         * @param text The contents of the high scores file
+         */
+        void read(std::string_view text);
+
+        /**
+         * @brief Read scores written by other instances
+         * @return True if the file was read, otherwise false
+         *
+         * The scores that have not been written to the file yet are kept
+         */
+        bool merge();
+
+        /**
+         * @brief Check if the high scores file changed since it was last read or written
+         * @return True if the file changed, otherwise false
+         */
+        bool isFileChanged() const;
+
+        /**
+         * @brief Record the current size and modification time of the high scores file
+         */
+        void rememberFileState();
+
+        /**
+         * @brief Rewrite the high scores file in descending order
+         * @return True if the file was rewritten, otherwise false
+         */
+        bool compact();
+
+    private:
+        ScoreTable highScores_;         //!< Every recorded score
+        ScoreIndex index_;              //!< Rankings of the recorded scores
+        std::vector<ScoreFileError> malformedLines_; //!< Lines skipped by the last load
+        std::size_t numSaved_;          //!< Number of scores in the high scores file
+        std::size_t numUnsorted_;       //!< Number of scores appended to the file since it was last sorted
+        bool isNewlineNeeded_;          //!< A flag indicating whether or not the file does not end with a newline
+        std::uintmax_t fileSize_;       //!< Size of the file when it was last read or written
+        std::filesystem::file_time_type fileWriteTime_; //!< Modification time of the file when it was last read or written
         std::string highScoresFile_;    //!< High scores file to be read/written
     };
 }
@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_GAMESERVICES_H
+#define SUPERPACMAN_GAMESERVICES_H
+
+#include "Common/TuningTable.h"
+#include "Session/RewindBuffer.h"
+#include "Session/SessionTrace.h"
+#include "Telemetry/TelemetryWriter.h"
+#include "Env/Autopilot.h"
+#include <memory>
+
+namespace spm {
+    /**
+     * @brief Objects shared by the gameplay scenes of a game
+     *
+     * The services are created by spm::Game when the engine starts and
+     * handed to the scenes that need them by reference, like
+     * spm::GameSession
+     */
+    struct GameServices {
+        std::shared_ptr<TuningTable> tuning;          //!< Gameplay tuning values of every level
+        std::shared_ptr<RewindBuffer> rewindBuffer;   //!< Recent history of the session, shared so that a rewound level keeps its history
+        std::shared_ptr<TelemetryWriter> telemetry;   //!< Gameplay event log, nullptr if telemetry is disabled
+        std::shared_ptr<Autopilot> autopilot;         //!< Steers pacman, nullptr if the player steers
+        int autopilotThinkTime = 0;                   //!< Time the autopilot may think at each tile, in milliseconds
+        std::shared_ptr<SessionTrace> trace;          //!< Records the session at every tile pacman enters, nullptr if tracing is disabled
+    };
+}
+
+#endif
@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "GameSession.h"
+#include "Common/Constants.h"
+#include <IME/common/PropertyContainer.h>
+#include <algorithm>
+
+namespace spm {
+    namespace {
+        ///////////////////////////////////////////////////////////////
+        template <typename T>
+        void writeProperty(ime::PropertyContainer& cache, const std::string& name, T value) {
+            if (cache.hasProperty(name))
+                cache.setValue(name, value);
+            else
+                cache.addProperty({name, value});
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    GameSession::GameSession() :
+        level_{1},
+        score_{0},
+        highScore_{0},
+        lives_{Constants::PacManLives},
+        extraLivesWon_{0},
+        nextBonusStage_{FirstBonusStage},
+        masterVolume_{100.0f},
+        isCacheSynced_{false},
+        nextListenerId_{0}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void GameSession::startNewGame() {
+        setLevel(1);
+        setScore(0);
+        setLives(Constants::PacManLives);
+        setExtraLivesWon(0);
+        setNextBonusStage(FirstBonusStage);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameSession::setLevel(int level) {
+        setValue(level_, level, Field::Level);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int GameSession::getLevel() const {
+        return level_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameSession::setScore(int score) {
+        setValue(score_, score, Field::Score);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int GameSession::getScore() const {
+        return score_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameSession::setHighScore(int highScore) {
+        setValue(highScore_, highScore, Field::HighScore);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int GameSession::getHighScore() const {
+        return highScore_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameSession::setLives(int lives) {
+        setValue(lives_, lives, Field::Lives);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int GameSession::getLives() const {
+        return lives_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameSession::setExtraLivesWon(int extraLivesWon) {
+        setValue(extraLivesWon_, extraLivesWon, Field::ExtraLivesWon);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int GameSession::getExtraLivesWon() const {
+        return extraLivesWon_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameSession::setNextBonusStage(int level) {
+        setValue(nextBonusStage_, level, Field::NextBonusStage);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int GameSession::getNextBonusStage() const {
+        return nextBonusStage_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameSession::setMasterVolume(float volume) {
+        setValue(masterVolume_, volume, Field::MasterVolume);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    float GameSession::getMasterVolume() const {
+        return masterVolume_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int GameSession::onChange(ChangeListener listener) {
+        listeners_.emplace_back(nextListenerId_, std::move(listener));
+        return nextListenerId_++;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameSession::removeChangeListener(int id) {
+        listeners_.erase(std::remove_if(listeners_.begin(), listeners_.end(), [id](const auto& listener) {
+            return listener.first == id;
+        }), listeners_.end());
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameSession::syncCache(ime::PropertyContainer& cache) {
+        if (isCacheSynced_)
+            return;
+
+        writeProperty(cache, "CURRENT_LEVEL", level_);
+        writeProperty(cache, "CURRENT_SCORE", score_);
+        writeProperty(cache, "HIGH_SCORE", highScore_);
+        writeProperty(cache, "PLAYER_LIVES", lives_);
+        writeProperty(cache, "NUM_EXTRA_LIVES_WON", extraLivesWon_);
+        writeProperty(cache, "MASTER_VOLUME", masterVolume_);
+        isCacheSynced_ = true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    template <typename T>
+    void GameSession::setValue(T& value, T newValue, Field field) {
+        if (value == newValue)
+            return;
+
+        value = newValue;
+        isCacheSynced_ = false;
+
+        for (const auto& listener : listeners_)
+            listener.second(field);
+    }
+
+} // namespace spm
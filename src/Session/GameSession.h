@@ -0,0 +1,228 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_GAMESESSION_H
+#define SUPERPACMAN_GAMESESSION_H
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace ime {
+    class PropertyContainer;
+}
+
+namespace spm {
+    /**
+     * @brief The progress of the player through a game
+     *
+     * The session is owned by spm::Game and handed to the scenes that
+     * need it by reference, so that gameplay code reads and writes the
+     * values directly instead of looking them up in the engine cache by
+     * name. The cache is only brought up to date by syncCache
+     */
+    class GameSession {
+    public:
+        /**
+         * @brief The values of the session
+         */
+        enum class Field {
+            Level,          //!< The level being played
+            Score,          //!< The score of the current game
+            HighScore,      //!< The highest score ever achieved
+            Lives,          //!< The number of lives pacman has left
+            ExtraLivesWon,  //!< The number of extra lives won in the current game
+            NextBonusStage, //!< The level of the next bonus stage
+            MasterVolume    //!< The volume of all audio
+        };
+
+        using ChangeListener = std::function<void(Field field)>; //!< Called after a value of the session changes
+
+        static constexpr int FirstBonusStage = 3;   //!< The level of the first bonus stage of a game
+        static constexpr int BonusStageInterval = 4; //!< The number of levels from one bonus stage to the next
+
+        /**
+         * @brief Constructor
+         *
+         * The session starts at the beginning of a new game with a high
+         * score of zero and full volume
+         */
+        GameSession();
+
+        /**
+         * @brief Copy constructor
+         */
+        GameSession(const GameSession&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        GameSession& operator=(const GameSession&) = delete;
+
+        /**
+         * @brief Reset the session to the beginning of a new game
+         *
+         * The high score and the volume are left unchanged
+         */
+        void startNewGame();
+
+        /**
+         * @brief Set the level being played
+         * @param level The new level
+         */
+        void setLevel(int level);
+
+        /**
+         * @brief Get the level being played
+         * @return The level being played
+         */
+        int getLevel() const;
+
+        /**
+         * @brief Set the score of the current game
+         * @param score The new score
+         *
+         * The high score is not updated
+         */
+        void setScore(int score);
+
+        /**
+         * @brief Get the score of the current game
+         * @return The score of the current game
+         */
+        int getScore() const;
+
+        /**
+         * @brief Set the highest score ever achieved
+         * @param highScore The new high score
+         */
+        void setHighScore(int highScore);
+
+        /**
+         * @brief Get the highest score ever achieved
+         * @return The high score
+         */
+        int getHighScore() const;
+
+        /**
+         * @brief Set the number of lives pacman has left
+         * @param lives The new number of lives
+         */
+        void setLives(int lives);
+
+        /**
+         * @brief Get the number of lives pacman has left
+         * @return The number of lives pacman has left
+         */
+        int getLives() const;
+
+        /**
+         * @brief Set the number of extra lives won in the current game
+         * @param extraLivesWon The new number of extra lives won
+         */
+        void setExtraLivesWon(int extraLivesWon);
+
+        /**
+         * @brief Get the number of extra lives won in the current game
+         * @return The number of extra lives won
+         */
+        int getExtraLivesWon() const;
+
+        /**
+         * @brief Set the level of the next bonus stage
+         * @param level The new level of the next bonus stage
+         */
+        void setNextBonusStage(int level);
+
+        /**
+         * @brief Get the level of the next bonus stage
+         * @return The level of the next bonus stage
+         */
+        int getNextBonusStage() const;
+
+        /**
+         * @brief Set the volume of all audio
+         * @param volume The new volume, in the range [0, 100]
+         */
+        void setMasterVolume(float volume);
+
+        /**
+         * @brief Get the volume of all audio
+         * @return The volume of all audio
+         */
+        float getMasterVolume() const;
+
+        /**
+         * @brief Add a function to be called when a value changes
+         * @param listener The function to be called
+         * @return The identification number of the listener
+         *
+         * The listener is called after the value is changed, setting a
+         * value to the value it already has does not call it. Listeners
+         * must not add or remove listeners
+         *
+         * @see removeChangeListener
+         */
+        int onChange(ChangeListener listener);
+
+        /**
+         * @brief Remove a change listener
+         * @param id The identification number of the listener
+         */
+        void removeChangeListener(int id);
+
+        /**
+         * @brief Write the values that changed since the last sync to a cache
+         * @param cache The cache to write to
+         *
+         * The values are stored under "CURRENT_LEVEL", "CURRENT_SCORE",
+         * "HIGH_SCORE", "PLAYER_LIVES", "NUM_EXTRA_LIVES_WON" and
+         * "MASTER_VOLUME". Properties that do not exist are added
+         */
+        void syncCache(ime::PropertyContainer& cache);
+
+    private:
+        /**
+         * @brief Change a value and notify the listeners
+         * @param value The value to change
+         * @param newValue The new value
+         * @param field The field @a value belongs to
+         */
+        template <typename T>
+        void setValue(T& value, T newValue, Field field);
+
+    private:
+        int level_;                 //!< The level being played
+        int score_;                 //!< The score of the current game
+        int highScore_;             //!< The highest score ever achieved
+        int lives_;                 //!< The number of lives pacman has left
+        int extraLivesWon_;         //!< The number of extra lives won in the current game
+        int nextBonusStage_;        //!< The level of the next bonus stage
+        float masterVolume_;        //!< The volume of all audio
+        bool isCacheSynced_;        //!< False if a value changed since the last sync
+        int nextListenerId_;        //!< The identification number of the next listener
+        std::vector<std::pair<int, ChangeListener>> listeners_; //!< Functions called when a value changes
+    };
+}
+
+#endif
@@ -0,0 +1,224 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "RewindBuffer.h"
+#include "SessionSerializer.h"
+#include <algorithm>
+#include <cassert>
+
+namespace spm {
+    namespace {
+        ///////////////////////////////////////////////////////////////
+        constexpr std::size_t MaxRunLength = 255;   // Run lengths are stored in a single byte
+        constexpr std::size_t MaxRunGap = 4;        // Runs separated by fewer unchanged bytes are merged
+        constexpr std::size_t MaxEncodedSize = 0xFFFF; // Run offsets are stored in two bytes
+
+        ///////////////////////////////////////////////////////////////
+        // A delta is a sequence of runs: offset (2 bytes), length (1 byte), new bytes
+        void writeDelta(const std::vector<std::uint8_t>& from, const std::vector<std::uint8_t>& to, std::vector<std::uint8_t>& delta) {
+            std::size_t i = 0;
+            while (i < to.size()) {
+                if (from[i] == to[i]) {
+                    ++i;
+                    continue;
+                }
+
+                std::size_t start = i, lastChange = i;
+                for (std::size_t end = start + 1; end < to.size() && end - start < MaxRunLength; ++end) {
+                    if (from[end] != to[end])
+                        lastChange = end;
+                    else if (end - lastChange > MaxRunGap)
+                        break;
+                }
+
+                std::size_t length = lastChange - start + 1;
+                delta.push_back(static_cast<std::uint8_t>(start));
+                delta.push_back(static_cast<std::uint8_t>(start >> 8));
+                delta.push_back(static_cast<std::uint8_t>(length));
+                delta.insert(delta.end(), to.begin() + start, to.begin() + start + length);
+                i = start + length;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////
+        void applyDelta(const std::uint8_t* delta, std::size_t size, std::vector<std::uint8_t>& bytes) {
+            for (std::size_t i = 0; i < size;) {
+                std::size_t offset = delta[i] | (delta[i + 1] << 8);
+                std::size_t length = delta[i + 2];
+                assert(offset + length <= bytes.size() && "Corrupt rewind delta");
+                std::copy_n(delta + i + 3, length, bytes.begin() + offset);
+                i += 3 + length;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    RewindBuffer::RewindBuffer(std::size_t capacity, unsigned int keyframeInterval) :
+        capacity_{capacity},
+        keyframeInterval_{std::max(keyframeInterval, 1u)},
+        size_{0},
+        isPreviousValid_{false}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void RewindBuffer::record(std::uint64_t tick, const SessionState& state) {
+        if (capacity_ == 0)
+            return;
+
+        assert((segments_.empty() || tick > getLastTick()) && "Ticks must be recorded in increasing order");
+
+        current_.clear();
+        SessionSerializer::serialize(state, current_);
+
+        bool isKeyframe = isKeyframeDue(tick) ||
+            current_.size() != previous_.size() || // Grid or door count changed
+            current_.size() > MaxEncodedSize;
+
+        if (isKeyframe)
+            addKeyframe(tick);
+        else {
+            Segment& segment = segments_.back();
+            std::size_t oldSize = segment.data.size();
+            segment.offsets.push_back(static_cast<std::uint32_t>(oldSize));
+            writeDelta(previous_, current_, segment.data);
+            size_ += segment.data.size() - oldSize + sizeof(std::uint32_t);
+        }
+
+        previous_.swap(current_);
+        isPreviousValid_ = true;
+        evict();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void RewindBuffer::addKeyframe(std::uint64_t tick) {
+        Segment segment = std::move(spare_);
+        segment.firstTick = tick;
+        segment.data.assign(current_.begin(), current_.end());
+        segment.offsets.assign(1, 0);
+        size_ += segment.data.size() + sizeof(std::uint32_t);
+        segments_.push_back(std::move(segment));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void RewindBuffer::evict() {
+        while (size_ > capacity_ && segments_.size() > 1) {
+            Segment& oldest = segments_.front();
+            size_ -= oldest.data.size() + oldest.offsets.size() * sizeof(std::uint32_t);
+            spare_ = std::move(oldest);
+            segments_.pop_front();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool RewindBuffer::restore(std::uint64_t& tick, SessionState& state) const {
+        if (segments_.empty() || tick < segments_.front().firstTick)
+            return false;
+
+        auto segment = std::upper_bound(segments_.begin(), segments_.end(), tick, [](std::uint64_t value, const Segment& seg) {
+            return value < seg.firstTick;
+        }) - 1;
+
+        std::size_t numTicks = std::min<std::uint64_t>(tick - segment->firstTick, segment->offsets.size() - 1) + 1;
+        auto getEnd = [&segment](std::size_t index) {
+            return index + 1 < segment->offsets.size() ? segment->offsets[index + 1] : segment->data.size();
+        };
+
+        std::vector<std::uint8_t> bytes(segment->data.begin(), segment->data.begin() + getEnd(0));
+        for (std::size_t i = 1; i < numTicks; ++i)
+            applyDelta(segment->data.data() + segment->offsets[i], getEnd(i) - segment->offsets[i], bytes);
+
+        if (!SessionSerializer::deserialize(bytes.data(), bytes.size(), state))
+            return false;
+
+        tick = segment->firstTick + numTicks - 1;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool RewindBuffer::isKeyframeDue(std::uint64_t tick) const {
+        return !isPreviousValid_ ||
+            segments_.empty() ||
+            tick != getLastTick() + 1 ||
+            segments_.back().offsets.size() >= keyframeInterval_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void RewindBuffer::truncate(std::uint64_t tick) {
+        while (!segments_.empty() && segments_.back().firstTick > tick) {
+            size_ -= segments_.back().data.size() + segments_.back().offsets.size() * sizeof(std::uint32_t);
+            segments_.pop_back();
+        }
+
+        if (!segments_.empty() && getLastTick() > tick) {
+            Segment& segment = segments_.back();
+            std::size_t numTicks = tick - segment.firstTick + 1;
+            std::size_t oldSize = segment.data.size() + segment.offsets.size() * sizeof(std::uint32_t);
+            segment.data.resize(segment.offsets[numTicks]);
+            segment.offsets.resize(numTicks);
+            size_ -= oldSize - (segment.data.size() + segment.offsets.size() * sizeof(std::uint32_t));
+        }
+
+        // The encoded state of the last tick is no longer known
+        isPreviousValid_ = false;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void RewindBuffer::clear() {
+        segments_.clear();
+        size_ = 0;
+        isPreviousValid_ = false;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool RewindBuffer::isEmpty() const {
+        return segments_.empty();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint64_t RewindBuffer::getFirstTick() const {
+        assert(!segments_.empty() && "The rewind history is empty");
+        return segments_.front().firstTick;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint64_t RewindBuffer::getLastTick() const {
+        assert(!segments_.empty() && "The rewind history is empty");
+        return getLastTick(segments_.back());
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint64_t RewindBuffer::getLastTick(const Segment& segment) {
+        return segment.firstTick + segment.offsets.size() - 1;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t RewindBuffer::getSize() const {
+        return size_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t RewindBuffer::getCapacity() const {
+        return capacity_;
+    }
+}
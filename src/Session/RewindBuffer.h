@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_REWINDBUFFER_H
+#define SUPERPACMAN_REWINDBUFFER_H
+
+#include "SessionState.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Records the recent history of a gameplay session
+     *
+     * Every recorded tick is stored as the difference between its encoded
+     * session state and that of the previous tick. A full keyframe is
+     * stored periodically, so that any tick can be reconstructed by
+     * decoding the nearest keyframe before it and replaying the deltas
+     * in between.
+     *
+     * The buffer never uses more than its capacity (give or take one
+     * keyframe interval). When it fills up, the oldest keyframe and its
+     * deltas are discarded
+     */
+    class RewindBuffer {
+    public:
+        /**
+         * @brief Constructor
+         * @param capacity Maximum number of bytes used by the history
+         * @param keyframeInterval Number of ticks between keyframes
+         *
+         * A capacity of zero disables recording
+         */
+        explicit RewindBuffer(std::size_t capacity, unsigned int keyframeInterval);
+
+        /**
+         * @brief Record the state of the session at a tick
+         * @param tick The tick the state was captured on
+         * @param state The captured state
+         *
+         * Ticks must be recorded in increasing order. A tick that does
+         * not follow the previously recorded tick starts a new keyframe
+         */
+        void record(std::uint64_t tick, const SessionState& state);
+
+        /**
+         * @brief Reconstruct the state of the session at a tick
+         * @param tick The tick to be reconstructed. On success, it is set
+         *             to the tick that was actually reconstructed
+         * @param state The object to write the reconstructed state into
+         * @return True if a state was reconstructed, otherwise false
+         *
+         * If @a tick was not recorded, the latest recorded tick before it
+         * is reconstructed instead. The function fails if the history
+         * does not go back as far as @a tick
+         */
+        bool restore(std::uint64_t& tick, SessionState& state) const;
+
+        /**
+         * @brief Check if a tick would be recorded as a keyframe
+         * @param tick The tick to be checked
+         * @return True if recording @a tick starts a new keyframe, otherwise false
+         *
+         * A keyframe is also started when the encoded size of the state
+         * changes, which cannot be known before the state is recorded
+         */
+        bool isKeyframeDue(std::uint64_t tick) const;
+
+        /**
+         * @brief Discard the history after a tick
+         * @param tick The last tick to keep
+         *
+         * This function must be called after a session is rewound, so
+         * that the history continues from the restored tick
+         */
+        void truncate(std::uint64_t tick);
+
+        /**
+         * @brief Discard the whole history
+         */
+        void clear();
+
+        /**
+         * @brief Check if the history is empty
+         * @return True if empty, otherwise false
+         */
+        bool isEmpty() const;
+
+        /**
+         * @brief Get the oldest tick in the history
+         * @return The oldest recorded tick
+         *
+         * @warning The history must not be empty
+         */
+        std::uint64_t getFirstTick() const;
+
+        /**
+         * @brief Get the latest tick in the history
+         * @return The latest recorded tick
+         *
+         * @warning The history must not be empty
+         */
+        std::uint64_t getLastTick() const;
+
+        /**
+         * @brief Get the number of bytes used by the history
+         * @return The memory used by the history
+         */
+        std::size_t getSize() const;
+
+        /**
+         * @brief Get the maximum number of bytes used by the history
+         * @return The capacity of the buffer
+         */
+        std::size_t getCapacity() const;
+
+    private:
+        /**
+         * @brief A keyframe followed by the deltas of subsequent ticks
+         */
+        struct Segment {
+            std::uint64_t firstTick = 0;          //!< The tick of the keyframe
+            std::vector<std::uint8_t> data;       //!< Keyframe and deltas, back to back
+            std::vector<std::uint32_t> offsets;   //!< Start of each tick in data
+        };
+
+        /**
+         * @brief Get the last tick of a segment
+         * @param segment The segment to get the last tick of
+         * @return The last tick of @a segment
+         */
+        static std::uint64_t getLastTick(const Segment& segment);
+
+        /**
+         * @brief Start a new segment
+         * @param tick The tick of the keyframe
+         */
+        void addKeyframe(std::uint64_t tick);
+
+        /**
+         * @brief Discard the oldest segments until the history fits
+         */
+        void evict();
+
+    private:
+        std::size_t capacity_;                 //!< Maximum number of bytes used by the segments
+        unsigned int keyframeInterval_;        //!< Number of ticks between keyframes
+        std::deque<Segment> segments_;         //!< History, oldest first
+        std::size_t size_;                     //!< Number of bytes used by the segments
+        Segment spare_;                        //!< Last evicted segment, its memory is reused for the next keyframe
+        std::vector<std::uint8_t> previous_;   //!< Encoded state of the last recorded tick
+        std::vector<std::uint8_t> current_;    //!< Encoded state of the tick being recorded
+        bool isPreviousValid_;                 //!< A flag indicating whether or not the next tick can be a delta
+    };
+}
+
+#endif
@@ -0,0 +1,246 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SessionSerializer.h"
+#include <type_traits>
+
+namespace spm {
+    namespace {
+        ///////////////////////////////////////////////////////////////
+        constexpr std::uint32_t Magic = 0x534D5053; // "SPMS"
+        constexpr std::uint16_t FormatVersion = 1;
+
+        ///////////////////////////////////////////////////////////////
+        class Writer {
+        public:
+            explicit Writer(std::vector<std::uint8_t>& buffer) : buffer_{buffer} {}
+
+            template <typename T>
+            void write(T value) {
+                if constexpr (std::is_enum_v<T>)
+                    write(static_cast<std::underlying_type_t<T>>(value));
+                else if constexpr (std::is_same_v<T, bool>)
+                    buffer_.push_back(value ? 1 : 0);
+                else {
+                    static_assert(std::is_integral_v<T>, "Only integers can be written");
+                    auto bits = static_cast<std::make_unsigned_t<T>>(value);
+                    for (std::size_t i = 0; i < sizeof(T); ++i)
+                        buffer_.push_back(static_cast<std::uint8_t>(bits >> (8 * i)));
+                }
+            }
+
+        private:
+            std::vector<std::uint8_t>& buffer_;
+        };
+
+        ///////////////////////////////////////////////////////////////
+        class Reader {
+        public:
+            Reader(const std::uint8_t* data, std::size_t size) : data_{data}, size_{size}, pos_{0}, isValid_{true} {}
+
+            template <typename T>
+            T read() {
+                if constexpr (std::is_enum_v<T>)
+                    return static_cast<T>(read<std::underlying_type_t<T>>());
+                else if constexpr (std::is_same_v<T, bool>)
+                    return read<std::uint8_t>() != 0;
+                else {
+                    static_assert(std::is_integral_v<T>, "Only integers can be read");
+                    if (size_ - pos_ < sizeof(T)) {
+                        isValid_ = false;
+                        pos_ = size_;
+                        return T{};
+                    }
+
+                    std::make_unsigned_t<T> bits = 0;
+                    for (std::size_t i = 0; i < sizeof(T); ++i)
+                        bits |= static_cast<std::make_unsigned_t<T>>(static_cast<std::make_unsigned_t<T>>(data_[pos_++]) << (8 * i));
+
+                    return static_cast<T>(bits);
+                }
+            }
+
+            template <typename T>
+            void read(T& value) {
+                value = read<T>();
+            }
+
+            bool isValid() const {
+                return isValid_;
+            }
+
+            std::size_t getRemaining() const {
+                return size_ - pos_;
+            }
+
+        private:
+            const std::uint8_t* data_;
+            std::size_t size_;
+            std::size_t pos_;
+            bool isValid_;
+        };
+
+        ///////////////////////////////////////////////////////////////
+        void writeTimer(Writer& writer, const SessionState::Timer& timer) {
+            writer.write(timer.status);
+            writer.write(timer.remaining);
+        }
+
+        ///////////////////////////////////////////////////////////////
+        void readTimer(Reader& reader, SessionState::Timer& timer) {
+            reader.read(timer.status);
+            reader.read(timer.remaining);
+        }
+
+        ///////////////////////////////////////////////////////////////
+        void writeActor(Writer& writer, const SessionState::Actor& actor) {
+            writer.write(actor.isPresent);
+            writer.write(actor.row);
+            writer.write(actor.colm);
+            writer.write(actor.dirX);
+            writer.write(actor.dirY);
+            writer.write(actor.progress);
+            writer.write(actor.state);
+            writer.write(actor.isLockedInGhostHouse);
+            writer.write(actor.isFlat);
+            writeTimer(writer, actor.houseArrest);
+        }
+
+        ///////////////////////////////////////////////////////////////
+        void readActor(Reader& reader, SessionState::Actor& actor) {
+            reader.read(actor.isPresent);
+            reader.read(actor.row);
+            reader.read(actor.colm);
+            reader.read(actor.dirX);
+            reader.read(actor.dirY);
+            reader.read(actor.progress);
+            reader.read(actor.state);
+            reader.read(actor.isLockedInGhostHouse);
+            reader.read(actor.isFlat);
+            readTimer(reader, actor.houseArrest);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void SessionSerializer::serialize(const SessionState& state, std::vector<std::uint8_t>& buffer) {
+        Writer writer{buffer};
+        writer.write(Magic);
+        writer.write(FormatVersion);
+
+        writer.write(state.level);
+        writer.write(state.score);
+        writer.write(state.highScore);
+        writer.write(state.lives);
+        writer.write(state.extraLivesWon);
+        writer.write(state.nextBonusStage);
+        writer.write(state.frightenedModeDuration);
+        writer.write(state.superModeDuration);
+
+        writer.write(state.pointsMultiplier);
+        writer.write(state.scatterWaveLevel);
+        writer.write(state.chaseWaveLevel);
+        writer.write(state.numFruitsEaten);
+        writer.write(state.numPelletsEaten);
+        writer.write(state.isChaseMode);
+        writer.write(state.starAppeared);
+        writer.write(state.isBonusStage);
+
+        writeTimer(writer, state.ghostAITimer);
+        writeTimer(writer, state.superModeTimer);
+        writeTimer(writer, state.powerModeTimer);
+        writeTimer(writer, state.starTimer);
+        writeTimer(writer, state.bonusStageTimer);
+
+        writeActor(writer, state.pacman);
+        for (const auto& ghost : state.ghosts)
+            writeActor(writer, ghost);
+
+        writer.write(state.rows);
+        writer.write(state.colms);
+        writer.write(static_cast<std::uint16_t>(state.items.size()));
+        buffer.insert(buffer.end(), state.items.begin(), state.items.end());
+
+        writer.write(static_cast<std::uint8_t>(state.doors.size()));
+        for (auto door : state.doors)
+            writer.write(door);
+
+        writer.write(state.randomState);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool SessionSerializer::deserialize(const std::uint8_t* data, std::size_t size, SessionState& state) {
+        Reader reader{data, size};
+        if (reader.read<std::uint32_t>() != Magic || reader.read<std::uint16_t>() != FormatVersion)
+            return false;
+
+        reader.read(state.level);
+        reader.read(state.score);
+        reader.read(state.highScore);
+        reader.read(state.lives);
+        reader.read(state.extraLivesWon);
+        reader.read(state.nextBonusStage);
+        reader.read(state.frightenedModeDuration);
+        reader.read(state.superModeDuration);
+
+        reader.read(state.pointsMultiplier);
+        reader.read(state.scatterWaveLevel);
+        reader.read(state.chaseWaveLevel);
+        reader.read(state.numFruitsEaten);
+        reader.read(state.numPelletsEaten);
+        reader.read(state.isChaseMode);
+        reader.read(state.starAppeared);
+        reader.read(state.isBonusStage);
+
+        readTimer(reader, state.ghostAITimer);
+        readTimer(reader, state.superModeTimer);
+        readTimer(reader, state.powerModeTimer);
+        readTimer(reader, state.starTimer);
+        readTimer(reader, state.bonusStageTimer);
+
+        readActor(reader, state.pacman);
+        for (auto& ghost : state.ghosts)
+            readActor(reader, ghost);
+
+        reader.read(state.rows);
+        reader.read(state.colms);
+        auto numItemBytes = reader.read<std::uint16_t>();
+        if (!reader.isValid() || reader.getRemaining() < numItemBytes || numItemBytes != (state.rows * state.colms + 7) / 8)
+            return false;
+
+        const std::uint8_t* items = data + (size - reader.getRemaining());
+        state.items.assign(items, items + numItemBytes);
+        for (std::uint16_t i = 0; i < numItemBytes; ++i)
+            reader.read<std::uint8_t>();
+
+        state.doors.resize(reader.read<std::uint8_t>());
+        for (auto& door : state.doors) {
+            reader.read(door);
+            if (door > SessionState::DoorStatus::Broken)
+                return false;
+        }
+
+        reader.read(state.randomState);
+        return reader.isValid() && reader.getRemaining() == 0;
+    }
+}
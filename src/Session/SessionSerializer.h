@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_SESSIONSERIALIZER_H
+#define SUPERPACMAN_SESSIONSERIALIZER_H
+
+#include "SessionState.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Converts a session state to and from a compact binary format
+     *
+     * The format is a fixed header (magic number and format version)
+     * followed by the fields of spm::SessionState in declaration order.
+     * Integers are little-endian regardless of the host, so saved states
+     * can be moved between machines. A typical state takes a few hundred
+     * bytes
+     */
+    class SessionSerializer {
+    public:
+        /**
+         * @brief Encode a session state
+         * @param state The state to be encoded
+         * @param buffer The buffer to append the encoded state to
+         */
+        static void serialize(const SessionState& state, std::vector<std::uint8_t>& buffer);
+
+        /**
+         * @brief Decode a session state
+         * @param data The encoded state
+         * @param size The size of the encoded state in bytes
+         * @param state The state to decode into
+         * @return True if the state was decoded or false if @a data is
+         *         truncated, corrupt or was written by an incompatible
+         *         version of the format
+         *
+         * @a state is left in an unspecified state if decoding fails
+         */
+        static bool deserialize(const std::uint8_t* data, std::size_t size, SessionState& state);
+    };
+}
+
+#endif
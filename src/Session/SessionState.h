@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_SESSIONSTATE_H
+#define SUPERPACMAN_SESSIONSTATE_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief The complete state of a gameplay session
+     *
+     * Together with the maze of the level it was captured on, the state
+     * is enough to continue a session in a freshly created
+     * spm::GameplayScene. Durations are stored in milliseconds
+     *
+     * @see GameplayScene::captureState, GameplayScene::restoreState
+     */
+    struct SessionState {
+        /**
+         * @brief The state of a gameplay timer
+         */
+        struct Timer {
+            /**
+             * @brief Timer status
+             */
+            enum class Status : std::uint8_t {
+                Stopped, //!< The timer is not scheduled
+                Running, //!< The timer is counting down
+                Paused   //!< The timer is scheduled but not counting down
+            };
+
+            Status status = Status::Stopped;  //!< The status of the timer
+            std::int32_t remaining = 0;       //!< Time left before the timer expires
+        };
+
+        /**
+         * @brief The state of pacman or a ghost
+         */
+        struct Actor {
+            bool isPresent = false;           //!< A flag indicating whether or not the actor is in the grid
+            std::int16_t row = 0;             //!< Row of the tile the actor is on or leaving
+            std::int16_t colm = 0;            //!< Column of the tile the actor is on or leaving
+            std::int8_t dirX = 0;             //!< Horizontal component of the actors direction
+            std::int8_t dirY = 0;             //!< Vertical component of the actors direction
+            std::uint16_t progress = 0;       //!< Distance travelled towards the next tile in 1/16 pixels
+            std::int8_t state = -1;           //!< spm::PacMan::State or spm::Ghost::State
+            bool isLockedInGhostHouse = false;//!< A flag indicating whether or not the ghost is locked in the ghost house
+            bool isFlat = false;              //!< A flag indicating whether or not the ghost is flat
+            Timer houseArrest;                //!< The ghosts house arrest timer
+        };
+
+        /**
+         * @brief The state of a door
+         */
+        enum class DoorStatus : std::uint8_t {
+            Locked,   //!< The door is locked
+            Unlocked, //!< The door was unlocked with a key and removed
+            Broken    //!< The door was burst open by super pacman
+        };
+
+        // Progress
+        std::int32_t level = 0;                //!< The current level
+        std::int32_t score = 0;                //!< The players score
+        std::int32_t highScore = 0;            //!< The highest score so far
+        std::int32_t lives = 0;                //!< Pacmans remaining lives
+        std::int32_t extraLivesWon = 0;        //!< Number of extra lives awarded
+        std::int32_t nextBonusStage = 0;       //!< The level of the next bonus stage
+        std::int32_t frightenedModeDuration = 0;  //!< Ghost frightened mode duration on this level
+        std::int32_t superModeDuration = 0;    //!< Pacman super mode duration on this level
+
+        // Level
+        std::int32_t pointsMultiplier = 1;     //!< Ghost points multiplier
+        std::uint8_t scatterWaveLevel = 0;     //!< The current scatter wave
+        std::uint8_t chaseWaveLevel = 0;       //!< The current chase wave
+        std::uint16_t numFruitsEaten = 0;      //!< Number of fruits eaten on the level
+        std::uint16_t numPelletsEaten = 0;     //!< Number of pellets eaten on the level
+        bool isChaseMode = false;              //!< A flag indicating whether or not the ghosts are in chase mode
+        bool starAppeared = false;             //!< A flag indicating whether or not a star was spawned on the level
+        bool isBonusStage = false;             //!< A flag indicating whether or not the level is a bonus stage
+
+        // Timers
+        Timer ghostAITimer;                    //!< Scatter-chase transition timer
+        Timer superModeTimer;                  //!< Pacman super mode timer
+        Timer powerModeTimer;                  //!< Ghost frightened mode timer
+        Timer starTimer;                       //!< Star despawn timer
+        Timer bonusStageTimer;                 //!< Bonus stage timer
+
+        // Actors
+        Actor pacman;                          //!< Pacman
+        std::array<Actor, 4> ghosts;           //!< Blinky, Pinky, Inky and Clyde (in that order)
+
+        // Maze
+        std::uint16_t rows = 0;                //!< Number of rows in the grid
+        std::uint16_t colms = 0;               //!< Number of columns in the grid
+        std::vector<std::uint8_t> items;       //!< One bit per tile, set if the tile still has a fruit, pellet or key
+        std::vector<DoorStatus> doors;         //!< Door states ordered by door id
+
+        std::uint64_t randomState = 0;         //!< State of the session random number generator
+    };
+}
+
+#endif
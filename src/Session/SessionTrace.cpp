@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SessionTrace.h"
+#include "SessionSerializer.h"
+#include <filesystem>
+#include <iterator>
+
+namespace spm {
+    namespace {
+        constexpr std::size_t RecordHeaderSize = 12; // Tick and size of the encoded state
+
+        ///////////////////////////////////////////////////////////////
+        std::uint64_t readInteger(const std::uint8_t* data, std::size_t size) {
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i < size; ++i)
+                value |= static_cast<std::uint64_t>(data[i]) << (8 * i);
+
+            return value;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    SessionTrace::SessionTrace(const std::string& filename) {
+        std::error_code error;
+        auto directory = std::filesystem::path(filename).parent_path();
+        if (!directory.empty())
+            std::filesystem::create_directories(directory, error);
+
+        file_.open(filename, std::ios::trunc | std::ios::binary);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void SessionTrace::record(std::uint64_t tick, const SessionState& state) {
+        if (!file_.is_open())
+            return;
+
+        buffer_.assign(RecordHeaderSize, 0);
+        SessionSerializer::serialize(state, buffer_);
+
+        auto size = static_cast<std::uint32_t>(buffer_.size() - RecordHeaderSize);
+        for (std::size_t i = 0; i < 8; ++i)
+            buffer_[i] = static_cast<std::uint8_t>(tick >> (8 * i));
+
+        for (std::size_t i = 0; i < 4; ++i)
+            buffer_[8 + i] = static_cast<std::uint8_t>(size >> (8 * i));
+
+        file_.write(reinterpret_cast<const char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool SessionTrace::load(const std::string& filename, std::vector<Entry>& entries) {
+        auto file = std::ifstream(filename, std::ios::binary);
+        if (!file.is_open())
+            return false;
+
+        auto bytes = std::vector<std::uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+        for (std::size_t pos = 0; pos < bytes.size();) {
+            if (bytes.size() - pos < RecordHeaderSize)
+                return false;
+
+            auto tick = readInteger(&bytes[pos], 8);
+            auto size = static_cast<std::size_t>(readInteger(&bytes[pos + 8], 4));
+            pos += RecordHeaderSize;
+
+            Entry entry{tick, SessionState()};
+            if (bytes.size() - pos < size || !SessionSerializer::deserialize(&bytes[pos], size, entry.state))
+                return false;
+
+            entries.push_back(std::move(entry));
+            pos += size;
+        }
+
+        return true;
+    }
+
+} // namespace spm
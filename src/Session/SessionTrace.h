@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_SESSIONTRACE_H
+#define SUPERPACMAN_SESSIONTRACE_H
+
+#include "SessionState.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Records the state of the session each time pacman enters a tile
+     *
+     * Traces are what spm::Environment is checked against: the ParityCheck
+     * tool replays each move of pacman through the environment and
+     * compares the outcome with the state the game recorded after it.
+     *
+     * A trace is a sequence of records, each made of the simulation step
+     * the state was captured on (8 bytes) and the size of the encoded state
+     * (4 bytes), both little-endian, followed by the state encoded by
+     * spm::SessionSerializer
+     */
+    class SessionTrace {
+    public:
+        /**
+         * @brief A recorded state
+         */
+        struct Entry {
+            std::uint64_t tick;     //!< Simulation step of the level the state was captured on
+            SessionState state;     //!< The state of the session
+        };
+
+        /**
+         * @brief Constructor
+         * @param filename The name of the trace file preceded by its path
+         *
+         * The directory of the trace is created if it does not exist and
+         * an existing trace is overwritten. If the trace cannot be opened,
+         * states are discarded
+         */
+        explicit SessionTrace(const std::string& filename);
+
+        /**
+         * @brief Copy constructor
+         */
+        SessionTrace(const SessionTrace&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        SessionTrace& operator=(const SessionTrace&) = delete;
+
+        /**
+         * @brief Append a state to the trace
+         * @param tick The simulation step of the level @a state was captured on
+         * @param state The state to be recorded
+         */
+        void record(std::uint64_t tick, const SessionState& state);
+
+        /**
+         * @brief Read a trace
+         * @param filename The name of the trace file preceded by its path
+         * @param entries The vector to append the recorded states to
+         * @return True if the whole trace was read or false if it could
+         *         not be opened or is corrupt
+         *
+         * The states that precede a corrupt record are still appended,
+         * so the trace of a game that crashed can be checked
+         */
+        static bool load(const std::string& filename, std::vector<Entry>& entries);
+
+    private:
+        std::ofstream file_;                //!< The trace file
+        std::vector<std::uint8_t> buffer_;  //!< Encoded record, reused between records
+    };
+}
+
+#endif
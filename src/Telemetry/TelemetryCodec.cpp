@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "TelemetryCodec.h"
+
+namespace spm {
+    namespace {
+        ///////////////////////////////////////////////////////////////
+        constexpr std::uint32_t Magic = 0x544D5053; // "SPMT"
+        constexpr std::uint16_t FormatVersion = 1;
+        constexpr std::size_t HeaderSize = 18;
+
+        ///////////////////////////////////////////////////////////////
+        void writeFixed(std::vector<std::uint8_t>& buffer, std::size_t pos, std::uint64_t value, std::size_t size) {
+            for (std::size_t i = 0; i < size; ++i)
+                buffer[pos + i] = static_cast<std::uint8_t>(value >> (8 * i));
+        }
+
+        ///////////////////////////////////////////////////////////////
+        std::uint64_t readFixed(const std::uint8_t* data, std::size_t size) {
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i < size; ++i)
+                value |= static_cast<std::uint64_t>(data[i]) << (8 * i);
+
+            return value;
+        }
+
+        ///////////////////////////////////////////////////////////////
+        void writeVarint(std::vector<std::uint8_t>& buffer, std::uint64_t value) {
+            while (value >= 0x80) {
+                buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+
+            buffer.push_back(static_cast<std::uint8_t>(value));
+        }
+
+        ///////////////////////////////////////////////////////////////
+        bool readVarint(const std::uint8_t*& data, const std::uint8_t* end, std::uint64_t& value) {
+            value = 0;
+            for (unsigned int shift = 0; shift < 64 && data != end; shift += 7) {
+                std::uint8_t byte = *data++;
+                value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                if (!(byte & 0x80))
+                    return true;
+            }
+
+            return false;
+        }
+
+        ///////////////////////////////////////////////////////////////
+        // Maps small negative numbers to small unsigned numbers (-1 to 1, 1 to 2, ...)
+        std::uint64_t zigzag(std::int64_t value) {
+            return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+        }
+
+        ///////////////////////////////////////////////////////////////
+        std::int64_t unzigzag(std::uint64_t value) {
+            return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+        }
+
+        ///////////////////////////////////////////////////////////////
+        std::uint32_t checksum(const std::uint8_t* data, std::size_t size) {
+            std::uint32_t hash = 2166136261u; // FNV-1a
+            for (std::size_t i = 0; i < size; ++i)
+                hash = (hash ^ data[i]) * 16777619u;
+
+            return hash;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TelemetryCodec::encode(const std::vector<TelemetryEvent>& events, std::vector<std::uint8_t>& buffer) {
+        std::size_t headerPos = buffer.size();
+        buffer.resize(headerPos + HeaderSize);
+
+        std::uint64_t previousTick = 0;
+        for (const auto& event : events) {
+            // Ticks restart on every level, so the difference may be negative
+            writeVarint(buffer, zigzag(static_cast<std::int64_t>(event.tick - previousTick)));
+            writeVarint(buffer, static_cast<std::uint8_t>(event.type));
+            writeVarint(buffer, event.level);
+            writeVarint(buffer, event.subject);
+            writeVarint(buffer, zigzag(event.row));
+            writeVarint(buffer, zigzag(event.colm));
+            writeVarint(buffer, zigzag(event.value));
+            previousTick = event.tick;
+        }
+
+        std::size_t payloadSize = buffer.size() - headerPos - HeaderSize;
+        writeFixed(buffer, headerPos, Magic, 4);
+        writeFixed(buffer, headerPos + 4, FormatVersion, 2);
+        writeFixed(buffer, headerPos + 6, events.size(), 4);
+        writeFixed(buffer, headerPos + 10, payloadSize, 4);
+        writeFixed(buffer, headerPos + 14, checksum(buffer.data() + headerPos + HeaderSize, payloadSize), 4);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t TelemetryCodec::decode(const std::uint8_t* data, std::size_t size, std::vector<TelemetryEvent>& events) {
+        if (size < HeaderSize || readFixed(data, 4) != Magic || readFixed(data + 4, 2) != FormatVersion)
+            return 0;
+
+        auto numEvents = static_cast<std::size_t>(readFixed(data + 6, 4));
+        auto payloadSize = static_cast<std::size_t>(readFixed(data + 10, 4));
+        if (size - HeaderSize < payloadSize || checksum(data + HeaderSize, payloadSize) != readFixed(data + 14, 4))
+            return 0;
+
+        const std::uint8_t* pos = data + HeaderSize;
+        const std::uint8_t* end = pos + payloadSize;
+        std::size_t firstEvent = events.size();
+        std::uint64_t tick = 0;
+        for (std::size_t i = 0; i < numEvents; ++i) {
+            std::uint64_t fields[7];
+            for (auto& field : fields) {
+                if (!readVarint(pos, end, field)) {
+                    events.resize(firstEvent);
+                    return 0;
+                }
+            }
+
+            tick += static_cast<std::uint64_t>(unzigzag(fields[0]));
+
+            auto event = TelemetryEvent();
+            event.tick = tick;
+            event.type = static_cast<TelemetryEventType>(fields[1]);
+            event.level = static_cast<std::uint8_t>(fields[2]);
+            event.subject = static_cast<std::uint8_t>(fields[3]);
+            event.row = static_cast<std::int16_t>(unzigzag(fields[4]));
+            event.colm = static_cast<std::int16_t>(unzigzag(fields[5]));
+            event.value = static_cast<std::int32_t>(unzigzag(fields[6]));
+            events.push_back(event);
+        }
+
+        if (pos != end) {
+            events.resize(firstEvent);
+            return 0;
+        }
+
+        return HeaderSize + payloadSize;
+    }
+}
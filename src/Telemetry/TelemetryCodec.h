@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_TELEMETRYCODEC_H
+#define SUPERPACMAN_TELEMETRYCODEC_H
+
+#include "TelemetryEvent.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Converts batches of telemetry events to and from a compact binary format
+     *
+     * A batch is a fixed header (magic number, format version, number of
+     * events, payload size and payload checksum) followed by the payload.
+     * In the payload, each event is stored as variable length integers and
+     * its tick is stored as the difference from the previous event, so a
+     * typical event takes 6 to 8 bytes instead of 24. Batches are written
+     * back to back, and a batch that was cut short (e.g. by a crash) is
+     * detected by its checksum
+     */
+    class TelemetryCodec {
+    public:
+        /**
+         * @brief Encode a batch of events
+         * @param events The events to be encoded, in the order they occurred
+         * @param buffer The buffer to append the encoded batch to
+         */
+        static void encode(const std::vector<TelemetryEvent>& events, std::vector<std::uint8_t>& buffer);
+
+        /**
+         * @brief Decode a batch of events
+         * @param data The encoded batch, possibly followed by other batches
+         * @param size The size of @a data in bytes
+         * @param events The list to append the decoded events to
+         * @return The size of the decoded batch in bytes or 0 if @a data
+         *         is truncated, corrupt or was written by an incompatible
+         *         version of the format
+         *
+         * @a events is left unchanged if decoding fails
+         */
+        static std::size_t decode(const std::uint8_t* data, std::size_t size, std::vector<TelemetryEvent>& events);
+    };
+}
+
+#endif
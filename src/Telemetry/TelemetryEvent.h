@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_TELEMETRYEVENT_H
+#define SUPERPACMAN_TELEMETRYEVENT_H
+
+#include <cstdint>
+
+namespace spm {
+    /**
+     * @brief Gameplay occurrences recorded by the telemetry stream
+     *
+     * The meaning of spm::TelemetryEvent::subject and spm::TelemetryEvent::value
+     * depends on the type of the event and is given next to each type. Ghosts
+     * are identified by their index (Blinky, Pinky, Inky then Clyde). New types
+     * must be added at the end, the values are stored in log files
+     *
+     * Each game starts with a spm::TelemetryEventType::GameStarted event, so
+     * the events of a game can be told apart from the events of the games
+     * before and after it in the same log
+     */
+    enum class TelemetryEventType : std::uint8_t {
+        PacManDied,       //!< subject: ghost that caught pacman, value: lives left
+        GhostEaten,       //!< subject: eaten ghost, value: points awarded
+        KeyCollected,     //!< value: number of doors unlocked by the key
+        DoorBroken,       //!< subject: door id
+        StarSpawned,      //!< No subject or value
+        ScatterModeBegin, //!< subject: scatter wave, value: mode duration in milliseconds
+        ChaseModeBegin,   //!< subject: chase wave, value: mode duration in milliseconds
+        PowerModeBegin,   //!< value: mode duration in milliseconds
+        PowerModeEnd,     //!< No subject or value
+        SuperModeBegin,   //!< value: mode duration in milliseconds
+        SuperModeEnd,     //!< No subject or value
+        GameStarted,      //!< No subject or value
+        LevelCleared,     //!< value: time taken to clear the level in milliseconds
+        GameEnded         //!< value: final score
+    };
+
+    /**
+     * @brief A gameplay occurrence
+     */
+    struct TelemetryEvent {
+        std::uint64_t tick = 0;         //!< Simulation step of the level on which the event occurred
+        std::int32_t value = 0;         //!< Event specific value
+        std::int16_t row = -1;          //!< Row of the tile the event occurred on, -1 if it has no position
+        std::int16_t colm = -1;         //!< Column of the tile the event occurred on, -1 if it has no position
+        TelemetryEventType type = TelemetryEventType::PacManDied; //!< What occurred
+        std::uint8_t level = 0;         //!< The level being played
+        std::uint8_t subject = 0;       //!< Event specific identifier
+    };
+}
+
+#endif
@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "TelemetryWriter.h"
+#include "TelemetryCodec.h"
+#include <cassert>
+#include <chrono>
+#include <filesystem>
+
+namespace spm {
+    namespace {
+        ///////////////////////////////////////////////////////////////
+        const std::size_t QUEUE_CAPACITY = 4096; // Events are rare, the queue only fills up if the disk stalls
+        const std::size_t MAX_BATCH_SIZE = 1024;
+        const auto FLUSH_INTERVAL = std::chrono::milliseconds(250);
+
+        ///////////////////////////////////////////////////////////////
+        std::string getRotatedFilename(const std::string& filename, unsigned int index) {
+            return filename + "." + std::to_string(index);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    TelemetryWriter::TelemetryWriter(const std::string& filename, std::size_t maxFileSize, unsigned int maxFiles) :
+        queue_{QUEUE_CAPACITY},
+        numDropped_{0},
+        filename_{filename},
+        maxFileSize_{maxFileSize},
+        maxFiles_{maxFiles},
+        fileSize_{0},
+        isStopping_{false}
+    {
+        assert(maxFiles_ > 0 && "At least one telemetry log must be kept");
+
+        auto error = std::error_code();
+        auto directory = std::filesystem::path(filename_).parent_path();
+        if (!directory.empty())
+            std::filesystem::create_directories(directory, error);
+
+        fileSize_ = static_cast<std::size_t>(std::filesystem::file_size(filename_, error));
+        if (error)
+            fileSize_ = 0;
+
+        file_.open(filename_, std::ios::app | std::ios::binary);
+        thread_ = std::thread(&TelemetryWriter::run, this);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool TelemetryWriter::record(const TelemetryEvent& event) {
+        if (queue_.push(event))
+            return true;
+
+        numDropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t TelemetryWriter::getDroppedCount() const {
+        return numDropped_.load(std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TelemetryWriter::run() {
+        auto batch = std::vector<TelemetryEvent>();
+        batch.reserve(MAX_BATCH_SIZE);
+
+        bool isStopping = false;
+        while (!isStopping) {
+            {
+                auto lock = std::unique_lock<std::mutex>(mutex_);
+                wakeUp_.wait_for(lock, FLUSH_INTERVAL, [this] { return isStopping_; });
+                isStopping = isStopping_;
+            }
+
+            auto event = TelemetryEvent();
+            while (queue_.pop(event)) {
+                batch.push_back(event);
+                if (batch.size() == MAX_BATCH_SIZE)
+                    flush(batch);
+            }
+
+            if (!batch.empty())
+                flush(batch);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TelemetryWriter::flush(std::vector<TelemetryEvent>& batch) {
+        buffer_.clear();
+        TelemetryCodec::encode(batch, buffer_);
+        batch.clear();
+
+        if (fileSize_ > 0 && fileSize_ + buffer_.size() > maxFileSize_)
+            rotate();
+
+        if (!file_.is_open())
+            return;
+
+        file_.write(reinterpret_cast<const char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+        file_.flush();
+        fileSize_ += buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TelemetryWriter::rotate() {
+        file_.close();
+
+        auto error = std::error_code();
+        if (maxFiles_ == 1)
+            std::filesystem::remove(filename_, error);
+        else {
+            std::filesystem::remove(getRotatedFilename(filename_, maxFiles_ - 1), error);
+            for (auto i = maxFiles_ - 1; i > 1; --i)
+                std::filesystem::rename(getRotatedFilename(filename_, i - 1), getRotatedFilename(filename_, i), error);
+
+            std::filesystem::rename(filename_, getRotatedFilename(filename_, 1), error);
+        }
+
+        file_.clear();
+        file_.open(filename_, std::ios::trunc | std::ios::binary);
+        fileSize_ = 0;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    TelemetryWriter::~TelemetryWriter() {
+        {
+            auto lock = std::lock_guard<std::mutex>(mutex_);
+            isStopping_ = true;
+        }
+
+        wakeUp_.notify_one();
+        thread_.join();
+    }
+
+} // namespace spm
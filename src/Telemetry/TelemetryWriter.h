@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_TELEMETRYWRITER_H
+#define SUPERPACMAN_TELEMETRYWRITER_H
+
+#include "TelemetryEvent.h"
+#include "Common/SpscQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Writes telemetry events to a rotating binary log
+     *
+     * Events are handed over to a background thread through a lock-free
+     * queue, so recording an event never blocks on the disk. The thread
+     * periodically drains the queue and appends the events to the log
+     * in compressed batches (see spm::TelemetryCodec). When the log grows
+     * beyond its maximum size, it is renamed to "<filename>.1" (older logs
+     * to "<filename>.2" and so on) and a new log is started. Events
+     * recorded while the queue is full are dropped and counted
+     */
+    class TelemetryWriter {
+    public:
+        /**
+         * @brief Constructor
+         * @param filename The name of the log file preceded by its path
+         * @param maxFileSize The size at which the log is rotated, in bytes
+         * @param maxFiles The number of log files to keep, including the current one
+         *
+         * The directory of the log is created if it does not exist. If the
+         * log cannot be opened, events are discarded
+         */
+        TelemetryWriter(const std::string& filename, std::size_t maxFileSize, unsigned int maxFiles);
+
+        /**
+         * @brief Copy constructor
+         */
+        TelemetryWriter(const TelemetryWriter&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        TelemetryWriter& operator=(const TelemetryWriter&) = delete;
+
+        /**
+         * @brief Record an event
+         * @param event The event to be recorded
+         * @return True if the event was queued or false if it was dropped
+         *
+         * This function must always be called from the same thread
+         */
+        bool record(const TelemetryEvent& event);
+
+        /**
+         * @brief Get the number of events that were dropped because the queue was full
+         * @return The number of dropped events
+         */
+        std::size_t getDroppedCount() const;
+
+        /**
+         * @brief Destructor
+         *
+         * Writes the events that are still queued and stops the
+         * background thread
+         */
+        ~TelemetryWriter();
+
+    private:
+        /**
+         * @brief Drain the queue until the writer is destroyed (background thread)
+         */
+        void run();
+
+        /**
+         * @brief Append a batch of events to the log
+         * @param batch The events to be written, cleared afterwards
+         */
+        void flush(std::vector<TelemetryEvent>& batch);
+
+        /**
+         * @brief Start a new log, keeping the previous ones
+         */
+        void rotate();
+
+    private:
+        SpscQueue<TelemetryEvent> queue_;    //!< Events waiting to be written
+        std::atomic<std::size_t> numDropped_; //!< Number of events that did not fit in the queue
+        std::string filename_;              //!< Name of the current log file
+        std::size_t maxFileSize_;           //!< Size at which the log is rotated
+        unsigned int maxFiles_;             //!< Number of log files to keep
+        std::ofstream file_;                //!< The current log file
+        std::size_t fileSize_;              //!< Size of the current log file
+        std::vector<std::uint8_t> buffer_;  //!< Encoded batch, reused between batches
+        std::mutex mutex_;                  //!< Protects isStopping_
+        std::condition_variable wakeUp_;    //!< Wakes the background thread up early when stopping
+        bool isStopping_;                   //!< A flag indicating whether or not the writer is being destroyed
+        std::thread thread_;                //!< Background thread, started last
+    };
+}
+
+#endif
@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+// Lets the autopilot (see spm::Autopilot) play whole games in the headless
+// environment and reports how well it played and how fast it searched.
+//
+// Usage: AutopilotBench [-j threads] [-m maze] [-t think time] [-g games] [-s seed]
+//
+// The think time is the budget of each search in milliseconds. One line is
+// printed per game, followed by the mean score and the search throughput:
+// rollouts per second and environment steps per second over all threads
+
+#include "Env/Autopilot.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    ///////////////////////////////////////////////////////////////
+    int printUsage() {
+        std::cerr << "Usage: AutopilotBench [-j threads] [-m maze] [-t think time] [-g games] [-s seed]\n";
+        return EXIT_FAILURE;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    auto args = std::vector<std::string>(argv + 1, argv + argc);
+    auto numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    auto mazeFile = std::string("res/TextFiles/Mazes/GameplayMaze.txt");
+    auto thinkTime = 10ul;
+    auto numGames = 1ul;
+    auto seed = 0ul;
+
+    while (args.size() >= 2 && args[0].size() == 2 && args[0][0] == '-') {
+        unsigned long value = std::strtoul(args[1].c_str(), nullptr, 10);
+        switch (args[0][1]) {
+            case 'j': numThreads = static_cast<unsigned int>(value); break;
+            case 'm': mazeFile = args[1]; break;
+            case 't': thinkTime = value; break;
+            case 'g': numGames = value; break;
+            case 's': seed = value; break;
+            default: return printUsage();
+        }
+
+        args.erase(args.begin(), args.begin() + 2);
+    }
+
+    if (!args.empty() || numThreads == 0 || thinkTime == 0)
+        return printUsage();
+
+    auto layout = std::make_shared<spm::MazeLayout>();
+    if (!layout->loadFromFile(mazeFile)) {
+        std::cerr << "Failed to load maze " << mazeFile << '\n';
+        return EXIT_FAILURE;
+    }
+
+    auto autopilot = spm::Autopilot(layout, numThreads);
+    auto environment = spm::Environment(layout);
+    auto budget = std::chrono::microseconds(thinkTime * 1000);
+    std::uint64_t numRollouts = 0, numSearchSteps = 0, totalScore = 0;
+    auto searchTime = std::chrono::steady_clock::duration::zero();
+
+    for (unsigned long game = 0; game < numGames; ++game) {
+        environment.reset(seed + game);
+        std::uint64_t numSteps = 0;
+
+        for (bool isDone = false; !isDone; ++numSteps) {
+            auto start = std::chrono::steady_clock::now();
+            spm::Action action = autopilot.chooseAction(environment.getState(), budget);
+            searchTime += std::chrono::steady_clock::now() - start;
+            numRollouts += autopilot.getRolloutCount();
+            numSearchSteps += autopilot.getStepCount();
+
+            isDone = environment.step(action).done;
+        }
+
+        const spm::GameState& state = environment.getState();
+        totalScore += static_cast<std::uint64_t>(state.score);
+        std::cout << "game " << game << ": score " << state.score << ", level " << state.level << ", steps " << numSteps << '\n';
+    }
+
+    double seconds = std::max(std::chrono::duration<double>(searchTime).count(), 1e-9);
+    std::cout << "mean score: " << totalScore / std::max(numGames, 1ul) << '\n'
+              << "threads: " << autopilot.getThreadCount() << '\n'
+              << "rollouts/s: " << static_cast<std::uint64_t>(numRollouts / seconds) << '\n'
+              << "steps/s: " << static_cast<std::uint64_t>(numSearchSteps / seconds) << '\n';
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+// Rasterises the glyphs of a font into a texture atlas, so that numbers
+// can be drawn as sprites instead of being laid out as text at run time
+// (see spm::DigitDisplay).
+//
+// Usage: GlyphAtlas [-s pixel size] [-c characters] <font> <output png>
+//
+// The characters default to the digits 0 to 9. Each glyph is drawn in
+// white, with its coverage in the alpha channel, into its own cell. All
+// cells have the same size, the widest advance by the line height of the
+// font, and are laid out in a single row with one pixel between cells and
+// around the edges of the image, the layout ime::SpriteSheet expects with a
+// spacing of one.
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <png.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    ///////////////////////////////////////////////////////////////
+    struct Image {
+        unsigned int width = 0;
+        unsigned int height = 0;
+        std::vector<unsigned char> pixels; // RGBA, rows from top to bottom
+    };
+
+    ///////////////////////////////////////////////////////////////
+    bool writePng(const std::string& filename, const Image& image) {
+        std::FILE* file = std::fopen(filename.c_str(), "wb");
+        if (!file)
+            return false;
+
+        png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+        png_infop info = png ? png_create_info_struct(png) : nullptr;
+        if (!info || setjmp(png_jmpbuf(png))) {
+            png_destroy_write_struct(&png, &info);
+            std::fclose(file);
+            return false;
+        }
+
+        png_init_io(png, file);
+        png_set_IHDR(png, info, image.width, image.height, 8, PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE,
+            PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+        png_write_info(png, info);
+
+        for (unsigned int y = 0; y < image.height; ++y)
+            png_write_row(png, image.pixels.data() + y * image.width * 4);
+
+        png_write_end(png, nullptr);
+        png_destroy_write_struct(&png, &info);
+        return std::fclose(file) == 0;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool rasterise(FT_Face face, const std::string& characters, Image& atlas) {
+        // Every cell is as wide as the widest glyph advance so that numbers line up
+        long cellWidth = 0;
+        for (char character : characters) {
+            if (FT_Load_Char(face, static_cast<unsigned char>(character), FT_LOAD_DEFAULT) != 0)
+                return false;
+
+            cellWidth = std::max(cellWidth, face->glyph->advance.x >> 6);
+        }
+
+        long ascender = face->size->metrics.ascender >> 6;
+        long cellHeight = ascender - (face->size->metrics.descender >> 6);
+        if (cellWidth <= 0 || cellHeight <= 0)
+            return false;
+
+        atlas.width = static_cast<unsigned int>(characters.size() * (cellWidth + 1) + 1);
+        atlas.height = static_cast<unsigned int>(cellHeight + 2);
+        atlas.pixels.assign(atlas.width * atlas.height * 4, 0);
+
+        for (std::size_t i = 0; i < characters.size(); ++i) {
+            if (FT_Load_Char(face, static_cast<unsigned char>(characters[i]), FT_LOAD_RENDER) != 0)
+                return false;
+
+            const FT_GlyphSlot glyph = face->glyph;
+            const FT_Bitmap& bitmap = glyph->bitmap;
+            long cellLeft = static_cast<long>(1 + i * (cellWidth + 1));
+            long originX = cellLeft + ((glyph->advance.x >> 6) < cellWidth ? (cellWidth - (glyph->advance.x >> 6)) / 2 : 0);
+
+            for (unsigned int row = 0; row < bitmap.rows; ++row) {
+                for (unsigned int column = 0; column < bitmap.width; ++column) {
+                    long x = originX + glyph->bitmap_left + column;
+                    long y = 1 + ascender - glyph->bitmap_top + row;
+
+                    // Glyphs that overhang their cell are clipped instead of bleeding into their neighbours
+                    if (x < cellLeft || x >= cellLeft + cellWidth || y < 1 || y > cellHeight)
+                        continue;
+
+                    unsigned char coverage = bitmap.buffer[row * bitmap.pitch + column];
+                    if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+                        coverage = (bitmap.buffer[row * bitmap.pitch + column / 8] & (0x80 >> (column % 8))) ? 255 : 0;
+
+                    unsigned char* pixel = &atlas.pixels[(y * atlas.width + x) * 4];
+                    pixel[0] = pixel[1] = pixel[2] = 255;
+                    pixel[3] = coverage;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int printUsage() {
+        std::cerr << "Usage: GlyphAtlas [-s pixel size] [-c characters] <font> <output png>\n";
+        return EXIT_FAILURE;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    auto args = std::vector<std::string>(argv + 1, argv + argc);
+    auto pixelSize = 15ul;
+    auto characters = std::string("0123456789");
+
+    while (args.size() >= 2 && args[0].size() == 2 && args[0][0] == '-') {
+        switch (args[0][1]) {
+            case 's': pixelSize = std::strtoul(args[1].c_str(), nullptr, 10); break;
+            case 'c': characters = args[1]; break;
+            default: return printUsage();
+        }
+
+        args.erase(args.begin(), args.begin() + 2);
+    }
+
+    if (args.size() != 2 || pixelSize == 0 || characters.empty())
+        return printUsage();
+
+    FT_Library library;
+    if (FT_Init_FreeType(&library) != 0) {
+        std::cerr << "Failed to initialise FreeType\n";
+        return EXIT_FAILURE;
+    }
+
+    FT_Face face;
+    if (FT_New_Face(library, args[0].c_str(), 0, &face) != 0 || FT_Set_Pixel_Sizes(face, 0, static_cast<FT_UInt>(pixelSize)) != 0) {
+        std::cerr << "Failed to load font " << args[0] << '\n';
+        FT_Done_FreeType(library);
+        return EXIT_FAILURE;
+    }
+
+    Image atlas;
+    bool isRasterised = rasterise(face, characters, atlas);
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+
+    if (!isRasterised) {
+        std::cerr << "Failed to rasterise the glyphs of " << args[0] << '\n';
+        return EXIT_FAILURE;
+    } else if (!writePng(args[1], atlas)) {
+        std::cerr << "Failed to write " << args[1] << '\n';
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Wrote " << characters.size() << " glyphs of " << (atlas.width - 1) / characters.size() - 1 << 'x' << atlas.height - 2
+              << " pixels to " << args[1] << '\n';
+    return EXIT_SUCCESS;
+}
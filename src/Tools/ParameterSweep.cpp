@@ -0,0 +1,383 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+// Plays the headless environment (see spm::Environment) with every
+// combination of a grid of gameplay parameters (see spm::GameParameters)
+// and reports how each combination plays.
+//
+// Usage: ParameterSweep [-j threads] [-m maze] [-g games] [-s seed] [-t think time] [-c checkpoint]
+//                       <output csv> <name[@level]=value,value,...>...
+//
+// A parameter is set on every level unless a level is given, e.g.
+// "super=6,8 chaseSpeed@5=1.1,1.2" sweeps the super mode duration of all
+// levels and the speed of chasing ghosts on level 5.
+//
+// Every combination plays the same games, seeded seed to seed + games - 1,
+// so combinations are compared on equal terms. Games are played by a greedy
+// bot that eats the closest item while keeping away from dangerous ghosts,
+// or by the autopilot (see spm::Autopilot) with one thread when a think time
+// in milliseconds is given.
+//
+// Games are shared out between worker threads one at a time. The result of
+// each game is appended to the checkpoint file as soon as it ends, and games
+// already in the checkpoint file are not played again, so an interrupted
+// sweep continues where it stopped. The output has one row per combination
+// with its win rate, mean level reached and score distribution.
+
+#include "Env/Autopilot.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    ///////////////////////////////////////////////////////////////
+    const std::uint64_t MAX_GAME_STEPS = 1000000; // Games that take longer are cut short and lost
+
+    ///////////////////////////////////////////////////////////////
+    struct Axis {
+        std::string name;
+        std::vector<std::string> values;
+    };
+
+    ///////////////////////////////////////////////////////////////
+    struct GameResult {
+        bool isPlayed = false;
+        bool isWon = false;
+        int level = 0;
+        int score = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////
+    struct Combination {
+        std::string key; // name=value pairs separated by ';', identifies the combination in checkpoints
+        std::vector<std::string> values;
+        spm::GameParameters parameters;
+        std::vector<GameResult> games;
+    };
+
+    ///////////////////////////////////////////////////////////////
+    bool parseAxis(const std::string& arg, Axis& axis) {
+        std::size_t equals = arg.find('=');
+        if (equals == std::string::npos || equals == 0)
+            return false;
+
+        axis.name = arg.substr(0, equals);
+        auto values = std::istringstream(arg.substr(equals + 1));
+        for (auto value = std::string(); std::getline(values, value, ',');) {
+            if (!value.empty())
+                axis.values.push_back(value);
+        }
+
+        return !axis.values.empty() && spm::GameParameters().set(axis.name, 0.0f);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::vector<Combination> makeCombinations(const std::vector<Axis>& axes, std::size_t numGames) {
+        auto combinations = std::vector<Combination>();
+        auto indices = std::vector<std::size_t>(axes.size(), 0);
+
+        while (true) {
+            auto combination = Combination();
+            for (std::size_t i = 0; i < axes.size(); ++i) {
+                const std::string& value = axes[i].values[indices[i]];
+                combination.key += (i > 0 ? ";" : "") + axes[i].name + "=" + value;
+                combination.values.push_back(value);
+                combination.parameters.set(axes[i].name, std::strtof(value.c_str(), nullptr));
+            }
+
+            combination.games.resize(numGames);
+            combinations.push_back(std::move(combination));
+
+            // Odometer order, the last axis changes fastest
+            std::size_t axis = axes.size();
+            while (axis > 0 && ++indices[axis - 1] == axes[axis - 1].values.size())
+                indices[--axis] = 0;
+
+            if (axis == 0)
+                return combinations;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    // Lines are "key seed won level score", a line cut short by an interrupted sweep is ignored.
+    // Returns true if the file ends in the middle of a line
+    bool readCheckpoint(const std::string& filename, std::uint64_t seed, std::vector<Combination>& combinations) {
+        auto file = std::ifstream(filename);
+        auto isLineCut = false;
+        for (auto line = std::string(); std::getline(file, line);) {
+            isLineCut = file.eof();
+            auto fields = std::istringstream(line);
+            auto key = std::string();
+            std::uint64_t gameSeed = 0;
+            auto result = GameResult();
+            if (!(fields >> key >> gameSeed >> result.isWon >> result.level >> result.score) || gameSeed < seed)
+                continue;
+
+            for (auto& combination : combinations) {
+                if (combination.key == key && gameSeed - seed < combination.games.size()) {
+                    result.isPlayed = true;
+                    combination.games[gameSeed - seed] = result;
+                }
+            }
+        }
+
+        return isLineCut;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    // Eats the closest item on a path that avoids dangerous ghosts, or runs from the closest ghost if there is none
+    spm::Action chooseGreedyAction(const spm::Environment& environment) {
+        const spm::GameState& state = environment.getState();
+        const spm::MazeLayout& layout = environment.getLayout();
+        const bool isSuper = state.isBonusStage || state.superTimer > 0;
+        const int offsets[5][2] = {{0, 0}, {-1, 0}, {0, -1}, {1, 0}, {0, 1}};
+
+        std::array<std::uint8_t, spm::MazeLayout::MaxRows * spm::MazeLayout::MaxColms> isDangerous{};
+        for (const auto& ghost : state.ghosts) {
+            if (isSuper || ghost.houseArrest > 0 || ghost.mode == spm::GhostMode::Frightened || ghost.mode == spm::GhostMode::Eaten)
+                continue;
+
+            for (const auto& offset : offsets) {
+                auto tile = ime::Index{ghost.tile.row + offset[0], ghost.tile.colm + offset[1]};
+                if (layout.isInBounds(tile))
+                    isDangerous[spm::MazeLayout::toCell(tile)] = 1;
+            }
+        }
+
+        auto isOpen = [&](const ime::Index& tile) {
+            int doorId = layout.getDoorId(tile);
+            return layout.isInBounds(tile) && !layout.isWall(tile) && (isSuper || doorId == 0 || !((state.lockedDoors >> doorId) & 1));
+        };
+
+        std::array<std::uint8_t, spm::MazeLayout::MaxRows * spm::MazeLayout::MaxColms> firstMove{};
+        std::array<ime::Index, spm::MazeLayout::MaxRows * spm::MazeLayout::MaxColms> frontier;
+        int head = 0, tail = 0;
+        frontier[tail++] = state.pacman.tile;
+        firstMove[spm::MazeLayout::toCell(state.pacman.tile)] = 0xff;
+
+        while (head < tail) {
+            ime::Index tile = frontier[head++];
+            int cell = spm::MazeLayout::toCell(tile);
+            if (state.items[cell] != spm::GameState::NoItem && tile != state.pacman.tile)
+                return static_cast<spm::Direction>(firstMove[cell]);
+
+            for (int direction = 1; direction <= 4; ++direction) {
+                auto next = ime::Index{tile.row + offsets[direction][0], tile.colm + offsets[direction][1]};
+                if (!isOpen(next) || firstMove[spm::MazeLayout::toCell(next)] != 0 || isDangerous[spm::MazeLayout::toCell(next)])
+                    continue;
+
+                firstMove[spm::MazeLayout::toCell(next)] = static_cast<std::uint8_t>(tile == state.pacman.tile ? direction : firstMove[cell]);
+                frontier[tail++] = next;
+            }
+        }
+
+        // Cornered, take the open direction furthest from the dangerous ghosts
+        auto bestAction = spm::Direction::None;
+        int bestDistance = -1;
+        for (int direction = 1; direction <= 4; ++direction) {
+            auto next = ime::Index{state.pacman.tile.row + offsets[direction][0], state.pacman.tile.colm + offsets[direction][1]};
+            if (environment.isPacManBlocked(static_cast<spm::Direction>(direction)))
+                continue;
+
+            int distance = spm::MazeLayout::MaxRows + spm::MazeLayout::MaxColms;
+            for (const auto& ghost : state.ghosts) {
+                if (ghost.mode == spm::GhostMode::Scatter || ghost.mode == spm::GhostMode::Chase)
+                    distance = std::min(distance, std::abs(ghost.tile.row - next.row) + std::abs(ghost.tile.colm - next.colm));
+            }
+
+            if (distance > bestDistance) {
+                bestAction = static_cast<spm::Direction>(direction);
+                bestDistance = distance;
+            }
+        }
+
+        return bestAction;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    GameResult playGame(const std::shared_ptr<const spm::MazeLayout>& layout, const spm::GameParameters& parameters,
+        std::uint64_t seed, unsigned long thinkTime)
+    {
+        auto environment = spm::Environment(layout, parameters);
+        auto autopilot = std::unique_ptr<spm::Autopilot>();
+        if (thinkTime > 0)
+            autopilot = std::make_unique<spm::Autopilot>(layout, 1, parameters);
+
+        environment.reset(seed);
+        bool isDone = false;
+        for (std::uint64_t step = 0; !isDone && step < MAX_GAME_STEPS; ++step) {
+            spm::Action action = autopilot ? autopilot->chooseAction(environment.getState(), std::chrono::milliseconds(thinkTime))
+                : chooseGreedyAction(environment);
+            isDone = environment.step(action).done;
+        }
+
+        const spm::GameState& state = environment.getState();
+        auto result = GameResult();
+        result.isPlayed = true;
+        result.isWon = isDone && state.lives > 0;
+        result.level = state.level;
+        result.score = state.score;
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool writeReport(const std::string& filename, const std::vector<Axis>& axes, const std::vector<Combination>& combinations) {
+        auto file = std::ofstream(filename, std::ios::trunc);
+        for (const auto& axis : axes)
+            file << axis.name << ',';
+
+        file << "games,win_rate,mean_level,mean_score,min_score,p25_score,median_score,p75_score,max_score\n";
+
+        for (const auto& combination : combinations) {
+            auto scores = std::vector<int>();
+            int numWins = 0;
+            double totalLevel = 0.0, totalScore = 0.0;
+            for (const auto& game : combination.games) {
+                scores.push_back(game.score);
+                numWins += game.isWon;
+                totalLevel += game.level;
+                totalScore += game.score;
+            }
+
+            std::sort(scores.begin(), scores.end());
+            auto percentile = [&scores](std::size_t percent) { return scores[(scores.size() - 1) * percent / 100]; };
+            auto numGames = static_cast<double>(scores.size());
+
+            for (const auto& value : combination.values)
+                file << value << ',';
+
+            file << scores.size() << ',' << numWins / numGames << ',' << totalLevel / numGames << ',' << totalScore / numGames << ','
+                 << percentile(0) << ',' << percentile(25) << ',' << percentile(50) << ',' << percentile(75) << ',' << percentile(100) << '\n';
+        }
+
+        return static_cast<bool>(file);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int printUsage() {
+        std::cerr << "Usage: ParameterSweep [-j threads] [-m maze] [-g games] [-s seed] [-t think time] [-c checkpoint]\n"
+                  << "                      <output csv> <name[@level]=value,value,...>...\n"
+                  << "Parameters:";
+
+        for (const auto& name : spm::GameParameters::getNames())
+            std::cerr << ' ' << name;
+
+        std::cerr << '\n';
+        return EXIT_FAILURE;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    auto args = std::vector<std::string>(argv + 1, argv + argc);
+    auto numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    auto mazeFile = std::string("res/TextFiles/Mazes/GameplayMaze.txt");
+    auto checkpointFile = std::string();
+    auto numGames = 20ul;
+    auto seed = 0ul;
+    auto thinkTime = 0ul;
+
+    while (args.size() >= 2 && args[0].size() == 2 && args[0][0] == '-') {
+        unsigned long value = std::strtoul(args[1].c_str(), nullptr, 10);
+        switch (args[0][1]) {
+            case 'j': numThreads = static_cast<unsigned int>(value); break;
+            case 'm': mazeFile = args[1]; break;
+            case 'g': numGames = value; break;
+            case 's': seed = value; break;
+            case 't': thinkTime = value; break;
+            case 'c': checkpointFile = args[1]; break;
+            default: return printUsage();
+        }
+
+        args.erase(args.begin(), args.begin() + 2);
+    }
+
+    if (args.size() < 2 || numThreads == 0 || numGames == 0)
+        return printUsage();
+
+    auto axes = std::vector<Axis>(args.size() - 1);
+    for (std::size_t i = 1; i < args.size(); ++i) {
+        if (!parseAxis(args[i], axes[i - 1])) {
+            std::cerr << "Invalid parameter " << args[i] << '\n';
+            return printUsage();
+        }
+    }
+
+    auto layout = std::make_shared<spm::MazeLayout>();
+    if (!layout->loadFromFile(mazeFile)) {
+        std::cerr << "Failed to load maze " << mazeFile << '\n';
+        return EXIT_FAILURE;
+    }
+
+    auto combinations = makeCombinations(axes, numGames);
+    auto checkpoint = std::ofstream();
+    if (!checkpointFile.empty()) {
+        bool isLineCut = readCheckpoint(checkpointFile, seed, combinations);
+        checkpoint.open(checkpointFile, std::ios::app);
+        if (isLineCut)
+            checkpoint << '\n';
+    }
+
+    // Games are handed out one at a time, so threads that get short games play more of them
+    auto checkpointMutex = std::mutex();
+    auto nextGame = std::atomic<std::size_t>(0);
+    const std::size_t totalGames = combinations.size() * numGames;
+    auto workers = std::vector<std::thread>();
+
+    for (unsigned int i = 0; i < std::min<std::size_t>(numThreads, totalGames); ++i) {
+        workers.emplace_back([&] {
+            for (auto game = nextGame++; game < totalGames; game = nextGame++) {
+                Combination& combination = combinations[game / numGames];
+                GameResult& result = combination.games[game % numGames];
+                if (result.isPlayed)
+                    continue;
+
+                result = playGame(layout, combination.parameters, seed + game % numGames, thinkTime);
+
+                if (checkpoint.is_open()) {
+                    auto lock = std::lock_guard<std::mutex>(checkpointMutex);
+                    checkpoint << combination.key << ' ' << seed + game % numGames << ' ' << result.isWon << ' '
+                               << result.level << ' ' << result.score << std::endl;
+                }
+            }
+        });
+    }
+
+    for (auto& worker : workers)
+        worker.join();
+
+    if (!writeReport(args[0], axes, combinations)) {
+        std::cerr << "Failed to write report to " << args[0] << '\n';
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
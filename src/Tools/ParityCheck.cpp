@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+// Checks the headless environment (see spm::Environment) against the game.
+//
+// Usage: ParityCheck [-m maze] [-n max reports] <trace>
+//
+// The trace is recorded by the game when SESSION_TRACE is set in the
+// settings and holds the state of the session each time pacman entered a
+// tile (see spm::SessionTrace). Each move of pacman is replayed through the
+// environment, starting from the state the game recorded before the move,
+// and the outcome is compared with the state the game recorded after it:
+// pacman's tile, the score, the lives, the number of items eaten, the
+// doors, and the mode and tile of every ghost. Ghosts may be one tile off,
+// since the game records them between two tiles.
+//
+// Moves across a new level, a new game or a rewind are skipped. The first
+// differences are printed with the move they occurred on, followed by the
+// number of differences of each kind. The exit code is non-zero if the
+// environment disagreed with the game on any move. The environment plays
+// with the built-in tuning values, so the trace must be recorded with them
+
+#include "Env/Environment.h"
+#include "Session/SessionTrace.h"
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    ///////////////////////////////////////////////////////////////
+    enum Check {
+        PacManTile,
+        Score,
+        Lives,
+        ItemsEaten,
+        Doors,
+        GhostMode,
+        GhostTile,
+        CheckCount
+    };
+
+    ///////////////////////////////////////////////////////////////
+    const std::array<const char*, CheckCount> checkNames = {
+        "pacman tile", "score", "lives", "items eaten", "doors", "ghost mode", "ghost tile"
+    };
+
+    ///////////////////////////////////////////////////////////////
+    int printUsage() {
+        std::cerr << "Usage: ParityCheck [-m maze] [-n max reports] <trace>\n";
+        return EXIT_FAILURE;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    spm::Direction toDirection(const spm::SessionState::Actor& actor) {
+        if (actor.dirY < 0)
+            return spm::Direction::Up;
+        else if (actor.dirX < 0)
+            return spm::Direction::Left;
+        else if (actor.dirY > 0)
+            return spm::Direction::Down;
+        else if (actor.dirX > 0)
+            return spm::Direction::Right;
+        else
+            return spm::Direction::None;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::string toString(const ime::Index& tile) {
+        return "(" + std::to_string(tile.row) + ", " + std::to_string(tile.colm) + ")";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    auto args = std::vector<std::string>(argv + 1, argv + argc);
+    auto mazeFile = std::string("res/TextFiles/Mazes/GameplayMaze.txt");
+    auto maxReports = 20ul;
+
+    while (args.size() >= 2 && args[0].size() == 2 && args[0][0] == '-') {
+        switch (args[0][1]) {
+            case 'm': mazeFile = args[1]; break;
+            case 'n': maxReports = std::strtoul(args[1].c_str(), nullptr, 10); break;
+            default: return printUsage();
+        }
+
+        args.erase(args.begin(), args.begin() + 2);
+    }
+
+    if (args.size() != 1)
+        return printUsage();
+
+    auto layout = std::make_shared<spm::MazeLayout>();
+    if (!layout->loadFromFile(mazeFile)) {
+        std::cerr << "Failed to load maze " << mazeFile << '\n';
+        return EXIT_FAILURE;
+    }
+
+    auto trace = std::vector<spm::SessionTrace::Entry>();
+    if (!spm::SessionTrace::load(args[0], trace)) {
+        if (trace.empty()) {
+            std::cerr << "Failed to read trace " << args[0] << '\n';
+            return EXIT_FAILURE;
+        }
+
+        std::cerr << "Trace " << args[0] << " is corrupt, checking the first " << trace.size() << " states\n";
+    }
+
+    auto environment = spm::Environment(layout);
+    auto numDifferences = std::array<unsigned long, CheckCount>{};
+    unsigned long numMoves = 0, numReports = 0;
+
+    for (std::size_t i = 0; i + 1 < trace.size(); ++i) {
+        const spm::SessionState& before = trace[i].state;
+        const spm::SessionState& after = trace[i + 1].state;
+
+        if (before.level != after.level || trace[i + 1].tick <= trace[i].tick || !before.pacman.isPresent
+            || before.rows != layout->getRowCount() || before.colms != layout->getColmCount())
+        {
+            continue;
+        }
+
+        environment.setState(before);
+        environment.step(toDirection(after.pacman));
+        const spm::GameState& state = environment.getState();
+        numMoves++;
+
+        auto report = [&](Check check, const std::string& expected, const std::string& actual) {
+            numDifferences[check]++;
+            if (numReports++ < maxReports) {
+                std::cout << "move " << i << " (level " << before.level << ", tick " << trace[i].tick << "): "
+                          << checkNames[check] << " is " << actual << ", the game has " << expected << '\n';
+            }
+        };
+
+        auto pacmanTile = ime::Index{after.pacman.row, after.pacman.colm};
+        if (state.pacman.tile != pacmanTile)
+            report(PacManTile, toString(pacmanTile), toString(state.pacman.tile));
+
+        if (state.score != after.score)
+            report(Score, std::to_string(after.score), std::to_string(state.score));
+
+        if (state.lives != after.lives)
+            report(Lives, std::to_string(after.lives), std::to_string(state.lives));
+
+        int numItemsEaten = after.numFruitsEaten + after.numPelletsEaten;
+        if (state.numItemsEaten != numItemsEaten)
+            report(ItemsEaten, std::to_string(numItemsEaten), std::to_string(state.numItemsEaten));
+
+        for (std::size_t door = 0; door < after.doors.size(); ++door) {
+            bool isLocked = after.doors[door] == spm::SessionState::DoorStatus::Locked;
+            if (((state.lockedDoors >> (door + 1)) & 1u) != isLocked) {
+                report(Doors, "door " + std::to_string(door) + (isLocked ? " locked" : " open"),
+                    "door " + std::to_string(door) + (isLocked ? " open" : " locked"));
+            }
+        }
+
+        for (std::size_t ghost = 0; ghost < after.ghosts.size(); ++ghost) {
+            const spm::SessionState::Actor& expected = after.ghosts[ghost];
+            const spm::GameState::Ghost& actual = state.ghosts[ghost];
+            if (!expected.isPresent || expected.state < 0)
+                continue;
+
+            if (actual.mode != static_cast<spm::GhostMode>(expected.state)) {
+                report(GhostMode, "ghost " + std::to_string(ghost) + " in mode " + std::to_string(expected.state),
+                    "ghost " + std::to_string(ghost) + " in mode " + std::to_string(static_cast<int>(actual.mode)));
+            }
+
+            auto expectedTile = ime::Index{expected.row, expected.colm};
+            if (std::abs(actual.tile.row - expectedTile.row) + std::abs(actual.tile.colm - expectedTile.colm) > 1) {
+                report(GhostTile, "ghost " + std::to_string(ghost) + " on " + toString(expectedTile),
+                    "ghost " + std::to_string(ghost) + " on " + toString(actual.tile));
+            }
+        }
+    }
+
+    unsigned long totalDifferences = 0;
+    std::cout << "moves checked: " << numMoves << '\n';
+    for (int check = 0; check < CheckCount; ++check) {
+        std::cout << checkNames[check] << " differences: " << numDifferences[check] << '\n';
+        totalDifferences += numDifferences[check];
+    }
+
+    return totalDifferences == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
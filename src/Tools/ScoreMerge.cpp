@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+// Merges the high score files of several game instances or batch workers
+// into a single high scores file, sorted in descending order.
+//
+// Usage: ScoreMerge [-n count] <output> <input>...
+//
+// The input files are read one at a time in a single pass. When a count
+// is given only the best scores are kept, so memory use does not depend
+// on the size of the inputs. The output may also be one of the inputs
+
+#include "Common/FileLock.h"
+#include "Common/MappedFile.h"
+#include "Scoreboard/ScoreFileParser.h"
+#include "Scoreboard/ScoreIndex.h"
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <queue>
+
+namespace {
+    ///////////////////////////////////////////////////////////////
+    struct Entry {
+        std::string owner;
+        int value;
+        unsigned int level;
+        std::size_t order; //!< Position of the score in the inputs, earlier scores win ties
+    };
+
+    ///////////////////////////////////////////////////////////////
+    bool isRankedBefore(const Entry& lhs, const Entry& rhs) {
+        return lhs.value > rhs.value || (lhs.value == rhs.value && lhs.order < rhs.order);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void writeScore(std::ostream& stream, std::string_view owner, int value, unsigned int level) {
+        stream << owner << ':' << value << ' ' << level << '\n';
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int printUsage() {
+        std::cerr << "Usage: ScoreMerge [-n count] <output> <input>...\n";
+        return EXIT_FAILURE;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    auto args = std::vector<std::string>(argv + 1, argv + argc);
+    auto count = std::size_t{0};
+    if (args.size() >= 2 && args[0] == "-n") {
+        count = static_cast<std::size_t>(std::strtoull(args[1].c_str(), nullptr, 10));
+        if (count == 0)
+            return printUsage();
+
+        args.erase(args.begin(), args.begin() + 2);
+    }
+
+    if (args.size() < 2)
+        return printUsage();
+
+    // With a count, only the best scores are kept in a heap whose top is the worst of them
+    auto best = std::priority_queue<Entry, std::vector<Entry>, decltype(&isRankedBefore)>(&isRankedBefore);
+    auto table = spm::ScoreTable();
+    auto order = std::size_t{0};
+
+    auto onScore = [&](std::string_view owner, int value, unsigned int level) {
+        if (count == 0) {
+            table.add(owner, value, level);
+            return;
+        }
+
+        auto entry = Entry{std::string(), value, level, order++};
+        if (best.size() == count) {
+            if (!isRankedBefore(entry, best.top()))
+                return;
+
+            best.pop();
+        }
+
+        entry.owner = owner;
+        best.push(std::move(entry));
+    };
+
+    const auto& output = args[0];
+    auto lock = spm::FileLock();
+    if (!lock.lock(output + ".lock")) {
+        std::cerr << "Failed to lock " << output << '\n';
+        return EXIT_FAILURE;
+    }
+
+    for (auto input = args.begin() + 1; input != args.end(); ++input) {
+        auto file = spm::MappedFile();
+        if (!file.open(*input)) {
+            std::cerr << "Failed to open " << *input << '\n';
+            return EXIT_FAILURE;
+        }
+
+        auto errors = std::vector<spm::ScoreFileError>();
+        spm::ScoreFileParser::parse(std::string_view(file.getData(), file.getSize()), onScore, errors);
+        for (const auto& error : errors)
+            std::cerr << *input << ':' << error.line << ": skipped malformed score \"" << error.text << "\"\n";
+    }
+
+    auto tempFile = output + ".tmp";
+    auto file = std::ofstream(tempFile, std::ios::trunc | std::ios::binary);
+    if (count == 0) {
+        auto index = spm::ScoreIndex(table);
+        index.rebuild();
+        for (auto i : index.getRanking())
+            writeScore(file, table.getOwner(i), table.getValue(i), table.getLevel(i));
+    } else {
+        auto entries = std::vector<Entry>();
+        entries.reserve(best.size());
+        for (; !best.empty(); best.pop())
+            entries.push_back(best.top());
+
+        // The heap yields the scores from worst to best
+        std::for_each(entries.rbegin(), entries.rend(), [&file](const Entry& entry) {
+            writeScore(file, entry.owner, entry.value, entry.level);
+        });
+    }
+
+    file.close();
+    auto error = std::error_code();
+    if (file)
+        std::filesystem::rename(tempFile, output, error);
+
+    if (!file || error) {
+        std::filesystem::remove(tempFile, error);
+        std::cerr << "Failed to write " << output << '\n';
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
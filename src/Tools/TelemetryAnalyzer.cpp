@@ -0,0 +1,350 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+// Aggregates gameplay telemetry logs (see spm::TelemetryWriter) into maze
+// heatmaps and CSV summaries.
+//
+// Usage: TelemetryAnalyzer [-j threads] [-m maze] <output directory> <log or directory>...
+//
+// Directories are searched recursively for logs. The logs are shared out
+// between worker threads, each of which maps one log at a time into memory
+// and decodes it batch by batch, so memory use does not depend on the
+// number or size of the logs. The following files are written:
+//
+//   deaths.ppm, ghosts_eaten.ppm, door_bursts.ppm - Per-tile heatmaps drawn over the maze
+//   tiles.csv       - Per-tile event counts
+//   levels.csv      - Number of clears and clear times of each level
+//   doors.csv       - Number of times each door was broken
+//   summary.csv     - Number of logs, games and events read
+
+#include "Common/MappedFile.h"
+#include "Telemetry/TelemetryCodec.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    ///////////////////////////////////////////////////////////////
+    const unsigned int TILE_SIZE = 16;      // Size of a maze tile in the heatmaps, in pixels
+    const unsigned int NUM_LEVELS = 256;
+    const unsigned int NUM_DOORS = 256;
+
+    ///////////////////////////////////////////////////////////////
+    struct Maze {
+        std::vector<std::string> rows;
+
+        int getNumRows() const { return static_cast<int>(rows.size()); }
+        int getNumColms() const { return rows.empty() ? 0 : static_cast<int>(rows.front().size()); }
+
+        bool isWall(int row, int colm) const {
+            char tile = rows[row][colm];
+            return tile == '|' || tile == '#' || tile == 'N';
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////
+    struct LevelClears {
+        std::uint64_t count = 0;
+        std::uint64_t totalTime = 0;
+        std::int32_t minTime = 0;
+        std::int32_t maxTime = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////
+    // Everything a worker thread gathers, merged once all logs are read
+    struct Statistics {
+        std::uint64_t numLogs = 0;
+        std::uint64_t numCorruptLogs = 0;
+        std::uint64_t numGames = 0;
+        std::uint64_t numEvents = 0;
+        std::vector<std::uint64_t> deaths;
+        std::vector<std::uint64_t> ghostsEaten;
+        std::vector<std::uint64_t> doorBursts;
+        std::vector<std::uint64_t> doorBurstsById = std::vector<std::uint64_t>(NUM_DOORS);
+        std::vector<LevelClears> levelClears = std::vector<LevelClears>(NUM_LEVELS);
+
+        explicit Statistics(std::size_t numTiles) :
+            deaths(numTiles), ghostsEaten(numTiles), doorBursts(numTiles)
+        {}
+
+        void merge(const Statistics& other) {
+            numLogs += other.numLogs;
+            numCorruptLogs += other.numCorruptLogs;
+            numGames += other.numGames;
+            numEvents += other.numEvents;
+
+            for (std::size_t i = 0; i < deaths.size(); ++i) {
+                deaths[i] += other.deaths[i];
+                ghostsEaten[i] += other.ghostsEaten[i];
+                doorBursts[i] += other.doorBursts[i];
+            }
+
+            for (std::size_t i = 0; i < NUM_DOORS; ++i)
+                doorBurstsById[i] += other.doorBurstsById[i];
+
+            for (std::size_t i = 0; i < NUM_LEVELS; ++i) {
+                LevelClears& clears = levelClears[i];
+                const LevelClears& otherClears = other.levelClears[i];
+                if (otherClears.count == 0)
+                    continue;
+
+                clears.minTime = clears.count == 0 ? otherClears.minTime : std::min(clears.minTime, otherClears.minTime);
+                clears.maxTime = clears.count == 0 ? otherClears.maxTime : std::max(clears.maxTime, otherClears.maxTime);
+                clears.count += otherClears.count;
+                clears.totalTime += otherClears.totalTime;
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////
+    bool loadMaze(const std::string& filename, Maze& maze) {
+        auto file = std::ifstream(filename);
+        auto line = std::string();
+        while (std::getline(file, line)) {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            if (line.empty() || line.front() == '#') // Comments, the maze itself has no '#' in its first column
+                continue;
+
+            if (!maze.rows.empty() && line.size() != maze.rows.front().size())
+                return false;
+
+            maze.rows.push_back(line);
+        }
+
+        return !maze.rows.empty();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void addEvent(const spm::TelemetryEvent& event, const Maze& maze, Statistics& statistics) {
+        statistics.numEvents++;
+
+        std::uint64_t* tileCount = nullptr;
+        switch (event.type) {
+            case spm::TelemetryEventType::GameStarted:
+                statistics.numGames++;
+                break;
+            case spm::TelemetryEventType::PacManDied:
+                tileCount = statistics.deaths.data();
+                break;
+            case spm::TelemetryEventType::GhostEaten:
+                tileCount = statistics.ghostsEaten.data();
+                break;
+            case spm::TelemetryEventType::DoorBroken:
+                tileCount = statistics.doorBursts.data();
+                statistics.doorBurstsById[event.subject]++;
+                break;
+            case spm::TelemetryEventType::LevelCleared: {
+                LevelClears& clears = statistics.levelClears[event.level];
+                clears.minTime = clears.count == 0 ? event.value : std::min(clears.minTime, event.value);
+                clears.maxTime = clears.count == 0 ? event.value : std::max(clears.maxTime, event.value);
+                clears.totalTime += static_cast<std::uint64_t>(std::max(event.value, 0));
+                clears.count++;
+                break;
+            }
+            default:
+                break;
+        }
+
+        if (tileCount && event.row >= 0 && event.row < maze.getNumRows() && event.colm >= 0 && event.colm < maze.getNumColms())
+            tileCount[event.row * maze.getNumColms() + event.colm]++;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void readLog(const std::string& filename, const Maze& maze, std::vector<spm::TelemetryEvent>& batch, Statistics& statistics) {
+        auto file = spm::MappedFile();
+        if (!file.open(filename)) {
+            statistics.numCorruptLogs++;
+            return;
+        }
+
+        statistics.numLogs++;
+        auto data = reinterpret_cast<const std::uint8_t*>(file.getData());
+        std::size_t pos = 0;
+        while (pos < file.getSize()) {
+            batch.clear();
+            std::size_t batchSize = spm::TelemetryCodec::decode(data + pos, file.getSize() - pos, batch);
+            if (batchSize == 0) { // The rest of the log was cut short or is damaged
+                statistics.numCorruptLogs++;
+                return;
+            }
+
+            for (const auto& event : batch)
+                addEvent(event, maze, statistics);
+
+            pos += batchSize;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool writeHeatmap(const std::string& filename, const Maze& maze, const std::vector<std::uint64_t>& counts) {
+        const unsigned int width = maze.getNumColms() * TILE_SIZE;
+        const unsigned int height = maze.getNumRows() * TILE_SIZE;
+        const std::uint64_t maxCount = std::max<std::uint64_t>(*std::max_element(counts.begin(), counts.end()), 1);
+
+        auto file = std::ofstream(filename, std::ios::trunc | std::ios::binary);
+        file << "P6\n" << width << ' ' << height << "\n255\n";
+
+        auto row = std::vector<std::uint8_t>(width * 3);
+        for (unsigned int y = 0; y < height; ++y) {
+            for (unsigned int x = 0; x < width; ++x) {
+                int tileRow = static_cast<int>(y / TILE_SIZE);
+                int tileColm = static_cast<int>(x / TILE_SIZE);
+                std::uint8_t* pixel = &row[x * 3];
+
+                if (maze.isWall(tileRow, tileColm)) {
+                    pixel[0] = 33; pixel[1] = 33; pixel[2] = 222;
+                    continue;
+                }
+
+                // Square root scaling keeps rarely visited tiles visible next to hot spots.
+                // Heat goes from black through red and yellow to white
+                double heat = std::sqrt(static_cast<double>(counts[tileRow * maze.getNumColms() + tileColm]) / static_cast<double>(maxCount));
+                pixel[0] = static_cast<std::uint8_t>(255.0 * std::min(1.0, heat * 3.0));
+                pixel[1] = static_cast<std::uint8_t>(255.0 * std::clamp(heat * 3.0 - 1.0, 0.0, 1.0));
+                pixel[2] = static_cast<std::uint8_t>(255.0 * std::clamp(heat * 3.0 - 2.0, 0.0, 1.0));
+            }
+
+            file.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()));
+        }
+
+        return static_cast<bool>(file);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool writeReports(const std::filesystem::path& directory, const Maze& maze, const Statistics& statistics) {
+        bool isWritten = writeHeatmap((directory / "deaths.ppm").string(), maze, statistics.deaths)
+            && writeHeatmap((directory / "ghosts_eaten.ppm").string(), maze, statistics.ghostsEaten)
+            && writeHeatmap((directory / "door_bursts.ppm").string(), maze, statistics.doorBursts);
+
+        auto tiles = std::ofstream(directory / "tiles.csv", std::ios::trunc);
+        tiles << "row,colm,deaths,ghosts_eaten,door_bursts\n";
+        for (int row = 0; row < maze.getNumRows(); ++row) {
+            for (int colm = 0; colm < maze.getNumColms(); ++colm) {
+                std::size_t i = row * maze.getNumColms() + colm;
+                if (statistics.deaths[i] || statistics.ghostsEaten[i] || statistics.doorBursts[i])
+                    tiles << row << ',' << colm << ',' << statistics.deaths[i] << ',' << statistics.ghostsEaten[i] << ',' << statistics.doorBursts[i] << '\n';
+            }
+        }
+
+        auto levels = std::ofstream(directory / "levels.csv", std::ios::trunc);
+        levels << "level,clears,mean_clear_time_ms,min_clear_time_ms,max_clear_time_ms\n";
+        for (std::size_t level = 0; level < NUM_LEVELS; ++level) {
+            const LevelClears& clears = statistics.levelClears[level];
+            if (clears.count > 0)
+                levels << level << ',' << clears.count << ',' << clears.totalTime / clears.count << ',' << clears.minTime << ',' << clears.maxTime << '\n';
+        }
+
+        auto doors = std::ofstream(directory / "doors.csv", std::ios::trunc);
+        doors << "door,bursts\n";
+        for (std::size_t door = 0; door < NUM_DOORS; ++door) {
+            if (statistics.doorBurstsById[door] > 0)
+                doors << door << ',' << statistics.doorBurstsById[door] << '\n';
+        }
+
+        auto summary = std::ofstream(directory / "summary.csv", std::ios::trunc);
+        summary << "logs,damaged_logs,games,events\n"
+                << statistics.numLogs << ',' << statistics.numCorruptLogs << ',' << statistics.numGames << ',' << statistics.numEvents << '\n';
+
+        return isWritten && tiles && levels && doors && summary;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int printUsage() {
+        std::cerr << "Usage: TelemetryAnalyzer [-j threads] [-m maze] <output directory> <log or directory>...\n";
+        return EXIT_FAILURE;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    auto args = std::vector<std::string>(argv + 1, argv + argc);
+    auto numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    auto mazeFile = std::string("res/TextFiles/Mazes/GameplayMaze.txt");
+
+    while (args.size() >= 2 && (args[0] == "-j" || args[0] == "-m")) {
+        if (args[0] == "-j")
+            numThreads = static_cast<unsigned int>(std::strtoul(args[1].c_str(), nullptr, 10));
+        else
+            mazeFile = args[1];
+
+        args.erase(args.begin(), args.begin() + 2);
+    }
+
+    if (args.size() < 2 || numThreads == 0)
+        return printUsage();
+
+    auto maze = Maze();
+    if (!loadMaze(mazeFile, maze)) {
+        std::cerr << "Failed to load maze " << mazeFile << '\n';
+        return EXIT_FAILURE;
+    }
+
+    auto logs = std::vector<std::string>();
+    for (auto input = args.begin() + 1; input != args.end(); ++input) {
+        auto error = std::error_code();
+        if (std::filesystem::is_directory(*input, error)) {
+            for (auto it = std::filesystem::recursive_directory_iterator(*input, error); !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error)) {
+                if (it->is_regular_file(error))
+                    logs.push_back(it->path().string());
+            }
+        } else
+            logs.push_back(*input);
+    }
+
+    // Logs are handed out one at a time, so a thread that gets small logs takes more of them
+    const std::size_t numTiles = static_cast<std::size_t>(maze.getNumRows()) * maze.getNumColms();
+    auto nextLog = std::atomic<std::size_t>(0);
+    auto statistics = std::vector<Statistics>(std::min<std::size_t>(numThreads, std::max<std::size_t>(logs.size(), 1)), Statistics(numTiles));
+    auto workers = std::vector<std::thread>();
+
+    for (auto& workerStatistics : statistics) {
+        workers.emplace_back([&, stats = &workerStatistics] {
+            auto batch = std::vector<spm::TelemetryEvent>();
+            for (auto i = nextLog++; i < logs.size(); i = nextLog++)
+                readLog(logs[i], maze, batch, *stats);
+        });
+    }
+
+    for (auto& worker : workers)
+        worker.join();
+
+    for (std::size_t i = 1; i < statistics.size(); ++i)
+        statistics.front().merge(statistics[i]);
+
+    auto error = std::error_code();
+    std::filesystem::create_directories(args[0], error);
+    if (!writeReports(args[0], maze, statistics.front())) {
+        std::cerr << "Failed to write reports to " << args[0] << '\n';
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -39,6 +39,7 @@ namespace spm {
         static inline auto InkySpawnTile = ime::Index{9, 15};           //!< Inky's spawn position when a level starts or restarts
         static inline auto ClydeSpawnTile = ime::Index{11, 13};         //!< Clyde's spawn position when a level starts or restarts
         static inline auto EatenGhostRespawnTile = ime::Index{11, 13};  //!< The tile a ghost targets after it is eaten (Once it reaches this tile, it gets revived)
+        static inline auto StarSpawnTile = ime::Index{15, 13};          //!< The tile the star appears on
         static inline const auto PINKY_SCATTER_TARGET_TILE = ime::Index{0, 2};   //!< The tile the pink ghost targets when in scatter state
         static inline const auto BLINKY_SCATTER_TARGET_TILE = ime::Index{0, 24}; //!< The tile the red ghost targets when in scatter state
         static inline const auto INKY_SCATTER_TARGET_TILE = ime::Index{28, 24};  //!< The tile blue ghost targets when in scatter state
@@ -56,6 +57,10 @@ namespace spm {
         static constexpr auto CLYDE_HOUSE_ARREST_DURATION = 21.0f;     //!< Time spent by clyde in the ghost house before entering the maze
         static constexpr auto STAR_ON_SCREEN_TIME = 10;                //!< Time a star appears on the screen before being removed
         static constexpr auto BONUS_STAGE_DURATION = 20;               //!< The amount of time the player has to complete a bonus stage
+        static constexpr auto SIMULATION_TICK_RATE = 120;              //!< The number of fixed gameplay simulation steps per second
+        static constexpr auto REWIND_BUFFER_SIZE = 1024;               //!< Default memory used to record gameplay for rewinding (kilobytes)
+        static constexpr auto TELEMETRY_LOG_SIZE = 1024;               //!< Size at which the telemetry log is rotated (kilobytes)
+        static constexpr auto TELEMETRY_LOG_COUNT = 4;                 //!< Number of telemetry logs kept, including the current one
 
         // 4. Miscellaneous
         static constexpr auto FIRST_EXTRA_LIFE_MIN_SCORE = 30000;    //!< The number of points the player must score before being awarded the first extra life
@@ -63,6 +68,7 @@ namespace spm {
         static constexpr auto THIRD_EXTRA_LIFE_MIN_SCORE = 200000;   //!< The number of points the player must score before being awarded the third extra life
         static constexpr auto STAR_SPAWN_EATEN_ITEMS = 15;           //!< The number of items the player must eat (excluding keys) to trigger a star spawn
         static constexpr auto RANDOM_KEY_POS_LEVEL = 5;             //!< The level on which keys are randomly placed
+        static constexpr auto SHORTEST_PATH_CHASE_LEVEL = 9;        //!< The level from which ghosts chasing pacman's tile follow the shortest path to him
 
         /**
          * @brief Points awarded to the player when pacman eats another actor
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "DifficultyTable.h"
+#include <utility>
+
+namespace spm {
+    namespace {
+        const std::pair<const char*, float LevelTuning::*> values[] = {
+            {"frightened", &LevelTuning::frightenedDuration},
+            {"super", &LevelTuning::superDuration},
+            {"inkyHouseArrest", &LevelTuning::inkyHouseArrestDuration},
+            {"clydeHouseArrest", &LevelTuning::clydeHouseArrestDuration},
+            {"scatterSpeed", &LevelTuning::scatterSpeedMultiplier},
+            {"chaseSpeed", &LevelTuning::chaseSpeedMultiplier},
+            {"frightenedSpeed", &LevelTuning::frightenedSpeedMultiplier},
+            {"eatenSpeed", &LevelTuning::eatenSpeedMultiplier},
+            {"slowLaneSpeed", &LevelTuning::slowLaneSpeedMultiplier}
+        };
+
+        const std::size_t NUM_WAVES = 5;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    float* LevelTuning::findValue(const std::string& name) {
+        for (const auto& [valueName, member] : values) {
+            if (name == valueName)
+                return &(this->*member);
+        }
+
+        // Wave values, e.g "scatter0" or "chase4"
+        auto getWave = [&name](const std::string& prefix) {
+            return name.size() == prefix.size() + 1 && name.compare(0, prefix.size(), prefix) == 0 && name.back() >= '0' && name.back() <= '4'
+                ? name.back() - '0' : -1;
+        };
+
+        if (int wave = getWave("scatter"); wave != -1)
+            return &scatterDurations[wave];
+        else if (int wave = getWave("chase"); wave != -1)
+            return &chaseDurations[wave];
+
+        return nullptr;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::vector<std::string> LevelTuning::getValueNames() {
+        std::vector<std::string> names;
+        for (std::size_t wave = 0; wave < NUM_WAVES; wave++)
+            names.push_back("scatter" + std::to_string(wave));
+
+        for (std::size_t wave = 0; wave < NUM_WAVES; wave++)
+            names.push_back("chase" + std::to_string(wave));
+
+        for (const auto& value : values)
+            names.emplace_back(value.first);
+
+        return names;
+    }
+}
@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_DIFFICULTYTABLE_H
+#define SUPERPACMAN_DIFFICULTYTABLE_H
+
+#include "Constants.h"
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Gameplay tuning values of a level
+     *
+     * Durations are in seconds and speeds are multiples of the normal
+     * speed of the actors
+     */
+    struct LevelTuning {
+        std::array<float, 5> scatterDurations;  //!< Scatter mode duration of each wave, 0 lasts a single frame
+        std::array<float, 5> chaseDurations;    //!< Chase mode duration of each wave
+        float frightenedDuration;               //!< Time ghosts stay frightened after a power pellet is eaten
+        float superDuration;                    //!< Time pacman stays super after a super pellet is eaten
+        float inkyHouseArrestDuration;          //!< Time inky spends in the ghost house when the level starts
+        float clydeHouseArrestDuration;         //!< Time clyde spends in the ghost house when the level starts
+        float scatterSpeedMultiplier;           //!< Speed of scattering ghosts
+        float chaseSpeedMultiplier;             //!< Speed of chasing ghosts
+        float frightenedSpeedMultiplier;        //!< Speed of frightened ghosts
+        float eatenSpeedMultiplier;             //!< Speed of eaten ghosts
+        float slowLaneSpeedMultiplier;          //!< Speed of ghosts in the slow lanes next to the tunnels
+
+        /**
+         * @brief Find a value by name
+         * @param name The name of a member without its "Duration" or
+         *             "SpeedMultiplier" suffix, waves are numbered from
+         *             0 (e.g. "frightened", "chaseSpeed" or "scatter4")
+         * @return The value or a nullptr if there is no value called @a name
+         */
+        float* findValue(const std::string& name);
+
+        /**
+         * @brief Get the names of all values
+         * @return The names of all values in declaration order
+         *
+         * @see findValue
+         */
+        static std::vector<std::string> getValueNames();
+    };
+
+    /**
+     * @brief Builds the difficulty schedule of the game
+     *
+     * The schedule is computed at compile time, use spm::DesignedDifficulty
+     */
+    struct DifficultyTable {
+        static constexpr int LevelCount = 16;                 //!< The number of levels in the game, it ends after the last one
+        using Levels = std::array<LevelTuning, LevelCount>;   //!< Tuning values of each level, the first level is at index 0
+
+        /**
+         * @brief Get the tuning values a level was designed with
+         * @param level The level, in the range [1, LevelCount]
+         * @return The tuning values of the level
+         */
+        static constexpr LevelTuning makeLevel(int level) {
+            const float scatterDuration = level < 5 ? 7.0f : 5.0f;
+            const float superDuration = Constants::SUPER_MODE_DURATION - static_cast<float>(level);
+
+            return LevelTuning{
+                {scatterDuration, scatterDuration, scatterDuration, 5.0f, level == 1 ? 5.0f : 0.0f},
+                {20.0f, 20.0f, 20.0f, level == 1 ? 20.0f : 17 * 60.0f, 24 * 60 * 60.0f},
+                std::max(Constants::POWER_MODE_DURATION - static_cast<float>(level), 0.0f),
+                superDuration > 0.0f ? superDuration : 2.0f,
+                std::max(Constants::INKY_HOUSE_ARREST_DURATION - static_cast<float>(level), 0.0f),
+                std::max(Constants::CLYDE_HOUSE_ARREST_DURATION - static_cast<float>(level), 0.0f),
+                1.0f,
+                1.08f,
+                0.5f,
+                4.0f,
+                level == 1 ? 0.40f : (level <= 4 ? 0.45f : 0.50f)
+            };
+        }
+
+        /**
+         * @brief Get the tuning values every level was designed with
+         * @return The tuning values of each level
+         */
+        static constexpr Levels makeLevels() {
+            Levels levels{};
+            for (int level = 1; level <= LevelCount; level++)
+                levels[level - 1] = makeLevel(level);
+
+            return levels;
+        }
+    };
+
+    /**
+     * @brief The tuning values every level was designed with, the first level is at index 0
+     */
+    inline constexpr DifficultyTable::Levels DesignedDifficulty = DifficultyTable::makeLevels();
+
+    static_assert(DesignedDifficulty[0].chaseDurations[3] == 20.0f, "Only the first level has a short fourth chase wave");
+    static_assert(DesignedDifficulty[1].chaseDurations[3] == 17 * 60.0f, "The fourth chase wave lasts 17 minutes after the first level");
+    static_assert(DesignedDifficulty[0].scatterDurations[4] > 0.0f && DesignedDifficulty[1].scatterDurations[4] == 0.0f,
+        "The last scatter wave lasts a single frame after the first level");
+    static_assert(DesignedDifficulty[0].frightenedDuration == Constants::POWER_MODE_DURATION - 1, "Frightened mode loses a second per level");
+    static_assert(DesignedDifficulty[6].frightenedDuration == 0.0f, "Ghosts are no longer frightened from level 7");
+    static_assert(DesignedDifficulty[7].superDuration == 1.0f && DesignedDifficulty[8].superDuration == 2.0f,
+        "Super mode lasts 2 seconds once it would run out");
+    static_assert(DesignedDifficulty[DifficultyTable::LevelCount - 1].clydeHouseArrestDuration > 0.0f, "Clyde is held in the ghost house on every level");
+}
+
+#endif
@@ -37,6 +37,27 @@ namespace spm {
         SuperModeBegin,      //!< Occurs when pacman eats a Super pellet
         SuperModeEnd,        //!< Occurs when super pellet effects wore off
     };
+
+    /**
+     * @brief Compile-time list of game events
+     */
+    template <GameEvent... Events>
+    struct GameEventList {};
+
+    /**
+     * @brief Every game event, used to dispatch a runtime event to a
+     *        compile-time handler
+     *
+     * @warning This list must be updated whenever a new event is added
+     */
+    using AllGameEvents = GameEventList<
+        GameEvent::FrightenedModeBegin,
+        GameEvent::FrightenedModeEnd,
+        GameEvent::ChaseModeBegin,
+        GameEvent::ScatterModeBegin,
+        GameEvent::SuperModeBegin,
+        GameEvent::SuperModeEnd
+    >;
 }
 
 #endif //SUPERPACMAN_GAMEEVENTS_H
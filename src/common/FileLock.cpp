@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "FileLock.h"
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/file.h>
+    #include <unistd.h>
+#endif
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    FileLock::FileLock() :
+        handle_{-1}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    bool FileLock::lock(const std::string& filename) {
+        unlock();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+            nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        OVERLAPPED overlapped{};
+        if (!LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &overlapped)) {
+            CloseHandle(file);
+            return false;
+        }
+
+        handle_ = reinterpret_cast<std::intptr_t>(file);
+#else
+        int file = ::open(filename.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (file == -1)
+            return false;
+
+        int result;
+        do {
+            result = flock(file, LOCK_EX);
+        } while (result == -1 && errno == EINTR);
+
+        if (result == -1) {
+            ::close(file);
+            return false;
+        }
+
+        handle_ = file;
+#endif
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void FileLock::unlock() {
+        if (handle_ == -1)
+            return;
+
+#ifdef _WIN32
+        HANDLE file = reinterpret_cast<HANDLE>(handle_);
+        OVERLAPPED overlapped{};
+        UnlockFileEx(file, 0, 1, 0, &overlapped);
+        CloseHandle(file);
+#else
+        // Closing the file releases the lock
+        ::close(static_cast<int>(handle_));
+#endif
+        handle_ = -1;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool FileLock::isLocked() const {
+        return handle_ != -1;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    FileLock::~FileLock() {
+        unlock();
+    }
+}
@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_FILELOCK_H
+#define SUPERPACMAN_FILELOCK_H
+
+#include <cstdint>
+#include <string>
+
+namespace spm {
+    /**
+     * @brief Advisory lock shared between processes
+     *
+     * The lock is held on a dedicated lock file rather than on the file
+     * it protects, so that the protected file can be replaced while the
+     * lock is held. Only processes that take the same lock are excluded,
+     * and the lock is released automatically if the process exits
+     */
+    class FileLock {
+    public:
+        /**
+         * @brief Default constructor
+         */
+        FileLock();
+
+        /**
+         * @brief Copy constructor
+         */
+        FileLock(const FileLock&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        FileLock& operator=(const FileLock&) = delete;
+
+        /**
+         * @brief Take the lock, waiting for other processes to release it
+         * @param filename The name of the lock file preceded by its path
+         * @return True if the lock was taken or false if the lock file
+         *         could not be opened
+         *
+         * The lock file is created if it does not exist. A previously
+         * held lock is released first
+         */
+        bool lock(const std::string& filename);
+
+        /**
+         * @brief Release the lock
+         */
+        void unlock();
+
+        /**
+         * @brief Check if the lock is held
+         * @return True if the lock is held, otherwise false
+         */
+        bool isLocked() const;
+
+        /**
+         * @brief Destructor
+         *
+         * Releases the lock
+         */
+        ~FileLock();
+
+    private:
+        std::intptr_t handle_; //!< Native handle of the lock file, -1 when not locked
+    };
+}
+
+#endif
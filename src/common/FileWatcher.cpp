@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "FileWatcher.h"
+
+#ifdef __linux__
+    #include <cerrno>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+namespace spm {
+    namespace {
+        ///////////////////////////////////////////////////////////////
+        std::filesystem::file_time_type getLastWriteTime(const std::filesystem::path& path) {
+            auto error = std::error_code();
+            auto time = std::filesystem::last_write_time(path, error);
+            return error ? std::filesystem::file_time_type::min() : time;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    FileWatcher::FileWatcher(const std::string& filename) :
+        path_{filename},
+        handle_{-1},
+        lastWriteTime_{getLastWriteTime(path_)}
+    {
+#ifdef __linux__
+        // The directory is watched because a file that is replaced is a new file with a new watch descriptor
+        handle_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (handle_ != -1) {
+            auto directory = path_.has_parent_path() ? path_.parent_path() : std::filesystem::path(".");
+            if (inotify_add_watch(handle_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) == -1) {
+                ::close(handle_);
+                handle_ = -1;
+            }
+        }
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool FileWatcher::hasChanged() {
+#ifdef __linux__
+        if (handle_ != -1) {
+            alignas(inotify_event) char buffer[4096];
+            bool isChanged = false;
+            std::string name = path_.filename().string();
+
+            for (ssize_t size; (size = ::read(handle_, buffer, sizeof(buffer))) > 0 || (size == -1 && errno == EINTR);) {
+                for (ssize_t pos = 0; pos < size;) {
+                    auto* event = reinterpret_cast<const inotify_event*>(buffer + pos);
+                    if (event->len > 0 && name == event->name)
+                        isChanged = true;
+
+                    pos += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+                }
+            }
+
+            return isChanged;
+        }
+#endif
+        auto lastWriteTime = getLastWriteTime(path_);
+        if (lastWriteTime == lastWriteTime_)
+            return false;
+
+        lastWriteTime_ = lastWriteTime;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    FileWatcher::~FileWatcher() {
+#ifdef __linux__
+        if (handle_ != -1)
+            ::close(handle_);
+#endif
+    }
+}
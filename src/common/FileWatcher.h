@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_FILEWATCHER_H
+#define SUPERPACMAN_FILEWATCHER_H
+
+#include <filesystem>
+#include <string>
+
+namespace spm {
+    /**
+     * @brief Reports when a file is written to
+     *
+     * The watcher does not block, it is meant to be polled once per
+     * frame. On Linux it is notified by inotify and polling costs a
+     * single non-blocking read. Elsewhere polling compares the time the
+     * file was last written to. Files that are replaced rather than
+     * written to, as many editors do when saving, are reported as well
+     */
+    class FileWatcher {
+    public:
+        /**
+         * @brief Constructor
+         * @param filename The name of the file to watch preceded by its path
+         *
+         * The file does not have to exist yet, but its directory does
+         */
+        explicit FileWatcher(const std::string& filename);
+
+        /**
+         * @brief Copy constructor
+         */
+        FileWatcher(const FileWatcher&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        /**
+         * @brief Check if the file was written to since the last check
+         * @return True if the file was written to, otherwise false
+         */
+        bool hasChanged();
+
+        /**
+         * @brief Destructor
+         */
+        ~FileWatcher();
+
+    private:
+        std::filesystem::path path_;                       //!< The watched file
+        int handle_;                                       //!< The inotify instance, -1 if inotify is not used
+        std::filesystem::file_time_type lastWriteTime_;    //!< The time the file was last written to, when inotify is not used
+    };
+}
+
+#endif
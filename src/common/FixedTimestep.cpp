@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "FixedTimestep.h"
+#include <algorithm>
+#include <cassert>
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    FixedTimestep::FixedTimestep(ime::Time step, ime::Time maxFrameTime) :
+        step_{step.asSeconds()},
+        maxFrameTime_{maxFrameTime.asSeconds()},
+        accumulator_{0.0f}
+    {
+        assert(step_ > 0.0f && "The step duration must be greater than zero");
+    }
+
+    ///////////////////////////////////////////////////////////////
+    unsigned int FixedTimestep::advance(ime::Time frameTime) {
+        accumulator_ += std::clamp(frameTime.asSeconds(), 0.0f, maxFrameTime_);
+
+        auto numSteps = static_cast<unsigned int>(accumulator_ / step_);
+        accumulator_ -= static_cast<float>(numSteps) * step_;
+        return numSteps;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    ime::Time FixedTimestep::getStep() const {
+        return ime::seconds(step_);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    float FixedTimestep::getAlpha() const {
+        return std::min(accumulator_ / step_, 1.0f);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void FixedTimestep::reset() {
+        accumulator_ = 0.0f;
+    }
+}
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_FIXEDTIMESTEP_H
+#define SUPERPACMAN_FIXEDTIMESTEP_H
+
+#include <IME/core/time/Time.h>
+
+namespace spm {
+    /**
+     * @brief Converts variable frame times into fixed simulation steps
+     *
+     * Frame time is accumulated and consumed in steps of equal length,
+     * the time left over after the last step is carried over to the next
+     * frame. This makes the simulation independent of the frame rate and
+     * reproducible for a given sequence of steps
+     */
+    class FixedTimestep {
+    public:
+        /**
+         * @brief Constructor
+         * @param step The duration of a single simulation step
+         * @param maxFrameTime The longest frame time that is simulated
+         *
+         * Frame times longer than @a maxFrameTime are clamped, otherwise
+         * a long stall (e.g. dragging the window) would be followed by a
+         * burst of steps that takes even longer to simulate
+         */
+        explicit FixedTimestep(ime::Time step, ime::Time maxFrameTime = ime::seconds(0.25f));
+
+        /**
+         * @brief Add the time taken by a frame
+         * @param frameTime The time passed since the last frame
+         * @return The number of steps to simulate
+         */
+        unsigned int advance(ime::Time frameTime);
+
+        /**
+         * @brief Get the duration of a single step
+         * @return The step duration
+         */
+        ime::Time getStep() const;
+
+        /**
+         * @brief Get how far the accumulated time is into the next step
+         * @return A value in the range [0, 1)
+         *
+         * This is the weight of the latest step when blending the last
+         * two simulated states for rendering
+         */
+        float getAlpha() const;
+
+        /**
+         * @brief Discard the accumulated time
+         */
+        void reset();
+
+    private:
+        float step_;          //!< Step duration in seconds
+        float maxFrameTime_;  //!< Longest simulated frame time in seconds
+        float accumulator_;   //!< Frame time that has not been simulated yet in seconds
+    };
+}
+
+#endif
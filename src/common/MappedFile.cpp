@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    MappedFile::MappedFile() :
+        data_{nullptr},
+        size_{0}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    bool MappedFile::open(const std::string& filename) {
+        close();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+            nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size)) {
+            CloseHandle(file);
+            return false;
+        }
+
+        if (size.QuadPart > 0) {
+            // The view keeps the mapping alive after the handles are closed
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping) {
+                data_ = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                CloseHandle(mapping);
+            }
+
+            if (!data_) {
+                CloseHandle(file);
+                return false;
+            }
+
+            size_ = static_cast<std::size_t>(size.QuadPart);
+        }
+
+        CloseHandle(file);
+#else
+        int file = ::open(filename.c_str(), O_RDONLY);
+        if (file == -1)
+            return false;
+
+        struct stat info{};
+        if (fstat(file, &info) == -1) {
+            ::close(file);
+            return false;
+        }
+
+        if (info.st_size > 0) {
+            // The mapping stays valid after the file is closed
+            void* data = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+            if (data == MAP_FAILED) {
+                ::close(file);
+                return false;
+            }
+
+            madvise(data, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+            data_ = static_cast<const char*>(data);
+            size_ = static_cast<std::size_t>(info.st_size);
+        }
+
+        ::close(file);
+#endif
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void MappedFile::close() {
+        if (data_) {
+#ifdef _WIN32
+            UnmapViewOfFile(data_);
+#else
+            munmap(const_cast<char*>(data_), size_);
+#endif
+        }
+
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const char* MappedFile::getData() const {
+        return data_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t MappedFile::getSize() const {
+        return size_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    MappedFile::~MappedFile() {
+        close();
+    }
+}
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_MAPPEDFILE_H
+#define SUPERPACMAN_MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace spm {
+    /**
+     * @brief Read-only view of a file mapped into memory
+     *
+     * The contents of the file are paged in by the operating system as
+     * they are accessed, without being copied into a buffer first
+     */
+    class MappedFile {
+    public:
+        /**
+         * @brief Default constructor
+         */
+        MappedFile();
+
+        /**
+         * @brief Copy constructor
+         */
+        MappedFile(const MappedFile&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * @brief Map a file into memory
+         * @param filename The name of the file preceded by its path
+         * @return True if the file was mapped or false if it could not
+         *         be opened
+         *
+         * A previously mapped file is unmapped first
+         */
+        bool open(const std::string& filename);
+
+        /**
+         * @brief Unmap the file
+         */
+        void close();
+
+        /**
+         * @brief Get the contents of the file
+         * @return The contents of the file or a nullptr if no file
+         *         is mapped or the file is empty
+         */
+        const char* getData() const;
+
+        /**
+         * @brief Get the size of the file
+         * @return The size of the file in bytes
+         */
+        std::size_t getSize() const;
+
+        /**
+         * @brief Destructor
+         */
+        ~MappedFile();
+
+    private:
+        const char* data_;  //!< Start of the mapping
+        std::size_t size_;  //!< Size of the mapping
+    };
+}
+
+#endif
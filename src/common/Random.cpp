@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Random.h"
+#include <cassert>
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    Random::Random(std::uint64_t seed) :
+        state_{0}
+    {
+        this->seed(seed);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Random::seed(std::uint64_t seed) {
+        // Scramble the seed (splitmix64), so that similar seeds produce unrelated sequences
+        std::uint64_t z = seed + 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        z ^= z >> 31;
+        state_ = z != 0 ? z : 0x9E3779B97F4A7C15ull;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int Random::nextInt(int min, int max) {
+        assert(min <= max && "Invalid range");
+        auto range = static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min) + 1;
+        return static_cast<int>(min + static_cast<std::int64_t>(next() % range));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint64_t Random::getState() const {
+        return state_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Random::setState(std::uint64_t state) {
+        assert(state != 0 && "Invalid random state");
+        state_ = state;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint64_t Random::next() {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return state_ * 0x2545F4914F6CDD1Dull;
+    }
+}
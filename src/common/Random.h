@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_RANDOM_H
+#define SUPERPACMAN_RANDOM_H
+
+#include <cstdint>
+
+namespace spm {
+    /**
+     * @brief Small, fast pseudo random number generator
+     *
+     * The generator (xorshift64*) keeps its entire state in a single
+     * 64-bit integer, so a gameplay session can save, restore and clone
+     * its random sequence cheaply
+     */
+    class Random {
+    public:
+        /**
+         * @brief Constructor
+         * @param seed The initial seed
+         */
+        explicit Random(std::uint64_t seed = 0);
+
+        /**
+         * @brief Restart the sequence from a seed
+         * @param seed The seed to restart from
+         */
+        void seed(std::uint64_t seed);
+
+        /**
+         * @brief Generate a random integer in an inclusive range
+         * @param min The smallest number that can be generated
+         * @param max The largest number that can be generated
+         * @return A random number in the range [min, max]
+         */
+        int nextInt(int min, int max);
+
+        /**
+         * @brief Get the internal state of the generator
+         * @return The state of the generator
+         *
+         * @see setState
+         */
+        std::uint64_t getState() const;
+
+        /**
+         * @brief Continue the sequence from a saved state
+         * @param state A state returned by spm::Random::getState
+         */
+        void setState(std::uint64_t state);
+
+    private:
+        /**
+         * @brief Advance the generator
+         * @return The next 64-bit random number
+         */
+        std::uint64_t next();
+
+    private:
+        std::uint64_t state_; //!< The state of the generator (never zero)
+    };
+}
+
+#endif
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_SPSCQUEUE_H
+#define SUPERPACMAN_SPSCQUEUE_H
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Lock-free, bounded single producer, single consumer queue
+     * @tparam T The type of the queued values
+     *
+     * The queue is a ring buffer whose capacity is rounded up to a power
+     * of two. Neither side ever waits for the other: pushing to a full
+     * queue fails instead of blocking the producer, and popping from an
+     * empty queue fails instead of blocking the consumer. The read and
+     * write positions are kept on separate cache lines so the two threads
+     * do not contend for them
+     */
+    template <typename T>
+    class SpscQueue {
+    public:
+        /**
+         * @brief Constructor
+         * @param capacity The minimum number of values the queue can hold
+         */
+        explicit SpscQueue(std::size_t capacity) {
+            assert(capacity > 0 && "The capacity of a queue must be greater than zero");
+
+            std::size_t size = 1;
+            while (size < capacity)
+                size *= 2;
+
+            values_.resize(size);
+            mask_ = size - 1;
+        }
+
+        /**
+         * @brief Add a value to the back of the queue (producer only)
+         * @param value The value to be added
+         * @return True if the value was added or false if the queue is full
+         */
+        bool push(const T& value) {
+            std::size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail - cachedHead_ == values_.size()) {
+                cachedHead_ = head_.load(std::memory_order_acquire);
+                if (tail - cachedHead_ == values_.size())
+                    return false;
+            }
+
+            values_[tail & mask_] = value;
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Remove the value at the front of the queue (consumer only)
+         * @param value Set to the removed value
+         * @return True if a value was removed or false if the queue is empty
+         */
+        bool pop(T& value) {
+            std::size_t head = head_.load(std::memory_order_relaxed);
+            if (head == cachedTail_) {
+                cachedTail_ = tail_.load(std::memory_order_acquire);
+                if (head == cachedTail_)
+                    return false;
+            }
+
+            value = values_[head & mask_];
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Get the number of values the queue can hold
+         * @return The capacity of the queue
+         */
+        std::size_t getCapacity() const {
+            return values_.size();
+        }
+
+    private:
+        static constexpr std::size_t CacheLineSize = 64;
+
+        std::vector<T> values_;                                       //!< Ring buffer storage
+        std::size_t mask_;                                            //!< Maps positions to ring buffer slots
+        alignas(CacheLineSize) std::atomic<std::size_t> head_{0};     //!< Position of the next value to be popped
+        std::size_t cachedTail_ = 0;                                  //!< Consumer's last seen tail, saves reloading it on every pop
+        alignas(CacheLineSize) std::atomic<std::size_t> tail_{0};     //!< Position of the next value to be pushed
+        std::size_t cachedHead_ = 0;                                  //!< Producer's last seen head, saves reloading it on every push
+    };
+}
+
+#endif
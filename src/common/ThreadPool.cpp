@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    ThreadPool::ThreadPool(unsigned int numThreads) :
+        task_{nullptr},
+        generation_{0},
+        numBusyThreads_{0},
+        isStopped_{false}
+    {
+        if (numThreads == 0)
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        threads_.reserve(numThreads - 1);
+        for (unsigned int i = 1; i < numThreads; i++)
+            threads_.emplace_back(&ThreadPool::work, this, i);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    unsigned int ThreadPool::getThreadCount() const {
+        return static_cast<unsigned int>(threads_.size()) + 1;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ThreadPool::run(const std::function<void(unsigned int)>& task) {
+        {
+            auto lock = std::lock_guard(mutex_);
+            task_ = &task;
+            numBusyThreads_ = static_cast<unsigned int>(threads_.size());
+            generation_++;
+        }
+
+        taskPosted_.notify_all();
+        task(0);
+
+        auto lock = std::unique_lock(mutex_);
+        taskFinished_.wait(lock, [this] { return numBusyThreads_ == 0; });
+        task_ = nullptr;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void ThreadPool::work(unsigned int threadIndex) {
+        std::uint64_t generation = 0;
+
+        while (true) {
+            const std::function<void(unsigned int)>* task;
+            {
+                auto lock = std::unique_lock(mutex_);
+                taskPosted_.wait(lock, [this, generation] { return isStopped_ || generation_ != generation; });
+
+                if (isStopped_)
+                    return;
+
+                generation = generation_;
+                task = task_;
+            }
+
+            (*task)(threadIndex);
+
+            {
+                auto lock = std::lock_guard(mutex_);
+                numBusyThreads_--;
+            }
+
+            taskFinished_.notify_one();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    ThreadPool::~ThreadPool() {
+        {
+            auto lock = std::lock_guard(mutex_);
+            isStopped_ = true;
+        }
+
+        taskPosted_.notify_all();
+
+        for (auto& thread : threads_)
+            thread.join();
+    }
+
+} // namespace spm
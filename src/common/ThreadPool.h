@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_THREADPOOL_H
+#define SUPERPACMAN_THREADPOOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Fixed set of threads that run the same task together
+     *
+     * The pool is meant for fork-join work that is repeated many times,
+     * such as a search that is run once per move: the threads are created
+     * once and sleep between tasks, instead of being created per task
+     */
+    class ThreadPool {
+    public:
+        /**
+         * @brief Constructor
+         * @param numThreads The number of threads that run each task,
+         *                   including the thread that calls run (0 uses
+         *                   one thread per hardware thread)
+         */
+        explicit ThreadPool(unsigned int numThreads = 0);
+
+        /**
+         * @brief Copy constructor
+         */
+        ThreadPool(const ThreadPool&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Get the number of threads that run each task
+         * @return The number of threads that run each task
+         */
+        unsigned int getThreadCount() const;
+
+        /**
+         * @brief Run a task on every thread and wait for it to finish
+         * @param task The task to run, called with the index of the thread
+         *             running it, in the range [0, getThreadCount())
+         *
+         * The calling thread runs the task with index 0. Tasks must not
+         * throw and must not call run on the same pool
+         */
+        void run(const std::function<void(unsigned int)>& task);
+
+        /**
+         * @brief Destructor
+         *
+         * Stops and joins the threads
+         */
+        ~ThreadPool();
+
+    private:
+        /**
+         * @brief Run tasks as they are posted until the pool is destroyed
+         * @param threadIndex The index of the thread
+         */
+        void work(unsigned int threadIndex);
+
+    private:
+        std::vector<std::thread> threads_;                  //!< The threads other than the calling thread
+        std::mutex mutex_;                                  //!< Guards the members below
+        std::condition_variable taskPosted_;                //!< Signalled when a task is posted or the pool stops
+        std::condition_variable taskFinished_;              //!< Signalled when a thread finishes the task
+        const std::function<void(unsigned int)>* task_;     //!< The task being run
+        std::uint64_t generation_;                          //!< Number of tasks posted so far
+        unsigned int numBusyThreads_;                       //!< Number of threads still running the task
+        bool isStopped_;                                    //!< True when the threads must exit
+    };
+}
+
+#endif
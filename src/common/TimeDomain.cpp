@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "TimeDomain.h"
+#include <algorithm>
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    TimeDomain::TimeDomain(const TimeDomain* parent) :
+        parent_{parent},
+        timescale_{1.0f},
+        pauseCount_{0},
+        revision_{0}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void TimeDomain::setTimescale(float timescale) {
+        timescale = std::max(timescale, 0.0f);
+        if (timescale_ != timescale) {
+            timescale_ = timescale;
+            revision_++;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    float TimeDomain::getTimescale() const {
+        return timescale_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimeDomain::pause() {
+        if (pauseCount_++ == 0)
+            revision_++;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimeDomain::resume() {
+        if (pauseCount_ > 0 && --pauseCount_ == 0)
+            revision_++;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool TimeDomain::isPaused() const {
+        return pauseCount_ > 0 || (parent_ && parent_->isPaused());
+    }
+
+    ///////////////////////////////////////////////////////////////
+    float TimeDomain::getEffectiveTimescale() const {
+        if (pauseCount_ > 0)
+            return 0.0f;
+
+        return parent_ ? timescale_ * parent_->getEffectiveTimescale() : timescale_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    unsigned int TimeDomain::getRevision() const {
+        // Both revisions only ever increase, so their sum changes whenever either does
+        return parent_ ? revision_ + parent_->getRevision() : revision_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    ime::Time TimeDomain::scale(ime::Time deltaTime) const {
+        return deltaTime * getEffectiveTimescale();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    TimerWheel& TimeDomain::getTimers() {
+        return timers_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimeDomain::update(ime::Time deltaTime) {
+        if (float timescale = getEffectiveTimescale(); timescale > 0.0f)
+            timers_.update(deltaTime * timescale);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    TimeDomainTracker::TimeDomainTracker() :
+        domain_{nullptr},
+        seenRevision_{0},
+        isStale_{false}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void TimeDomainTracker::setDomain(const TimeDomain& domain) {
+        domain_ = &domain;
+        isStale_ = true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool TimeDomainTracker::hasChanged() {
+        if (!domain_)
+            return false;
+
+        unsigned int revision = domain_->getRevision();
+        if (isStale_ || revision != seenRevision_) {
+            isStale_ = false;
+            seenRevision_ = revision;
+            return true;
+        }
+
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    float TimeDomainTracker::getTimescale() const {
+        return domain_ ? domain_->getEffectiveTimescale() : 1.0f;
+    }
+}
@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_TIMEDOMAIN_H
+#define SUPERPACMAN_TIMEDOMAIN_H
+
+#include "TimerWheel.h"
+
+namespace spm {
+    /**
+     * @brief A group of things that share the same flow of time
+     *
+     * Timers, grid movers and animators that belong to a domain can be
+     * paused or time-scaled together with a single call. Domains can be
+     * nested, the time of a child domain flows at its own timescale
+     * multiplied by that of its parent, and pausing a parent pauses all
+     * of its children
+     *
+     * A domain does not keep a list of its members. Timers are scheduled
+     * on the domain's own timer wheel and other members poll for changes
+     * using a spm::TimeDomainTracker, so pausing, resuming and rescaling
+     * a domain is O(1) regardless of how many members it has
+     */
+    class TimeDomain {
+    public:
+        /**
+         * @brief Constructor
+         * @param parent The domain this domain is nested in
+         *
+         * The parent must outlive this domain
+         */
+        explicit TimeDomain(const TimeDomain* parent = nullptr);
+
+        /**
+         * @brief Set the timescale
+         * @param timescale The new timescale
+         *
+         * A timescale of 2 makes time flow twice as fast and a timescale
+         * of 0.5 makes time flow at half the speed. Negative values are
+         * treated as zero
+         *
+         * By default, the timescale is 1
+         */
+        void setTimescale(float timescale);
+
+        /**
+         * @brief Get the timescale
+         * @return The timescale of the domain, excluding that of its parent
+         */
+        float getTimescale() const;
+
+        /**
+         * @brief Pause the domain
+         *
+         * Pauses are counted, a domain that was paused N times needs to be
+         * resumed N times before time flows again
+         *
+         * @see resume
+         */
+        void pause();
+
+        /**
+         * @brief Resume the domain
+         *
+         * @see pause
+         */
+        void resume();
+
+        /**
+         * @brief Check if the domain or one of its parents is paused
+         * @return True if time does not flow in the domain, otherwise false
+         */
+        bool isPaused() const;
+
+        /**
+         * @brief Get the rate at which time flows in the domain
+         * @return The product of the domain's timescale and that of its
+         *         parents or zero if the domain is paused
+         */
+        float getEffectiveTimescale() const;
+
+        /**
+         * @brief Get the revision of the domain
+         * @return A number that increases every time the effective
+         *         timescale of the domain may have changed
+         */
+        unsigned int getRevision() const;
+
+        /**
+         * @brief Convert a real time duration to domain time
+         * @param deltaTime The duration to be converted
+         * @return How much time passes in the domain during @a deltaTime
+         */
+        ime::Time scale(ime::Time deltaTime) const;
+
+        /**
+         * @brief Get the timers that run in the domain
+         * @return The domain's timer wheel
+         */
+        TimerWheel& getTimers();
+
+        /**
+         * @brief Advance the timers of the domain
+         * @param deltaTime Real time passed since last update
+         */
+        void update(ime::Time deltaTime);
+
+    private:
+        const TimeDomain* parent_;  //!< The domain this domain is nested in
+        float timescale_;           //!< The rate at which time flows relative to the parent
+        unsigned int pauseCount_;   //!< The number of unmatched pause calls
+        unsigned int revision_;     //!< Incremented when the timescale or pause state changes
+        TimerWheel timers_;         //!< Timers that run in this domain
+    };
+
+    /**
+     * @brief Notifies a member of a time domain when it needs to update
+     *        its timescale
+     */
+    class TimeDomainTracker {
+    public:
+        /**
+         * @brief Constructor
+         */
+        TimeDomainTracker();
+
+        /**
+         * @brief Set the domain to be tracked
+         * @param domain The domain to track
+         *
+         * The next call to spm::TimeDomainTracker::hasChanged returns true
+         */
+        void setDomain(const TimeDomain& domain);
+
+        /**
+         * @brief Check if the effective timescale of the domain changed
+         * @return True if the timescale changed since the last call,
+         *         otherwise false
+         *
+         * This function always returns false if no domain is tracked
+         */
+        bool hasChanged();
+
+        /**
+         * @brief Get the effective timescale of the tracked domain
+         * @return The effective timescale of the domain or 1 if no domain
+         *         is tracked
+         */
+        float getTimescale() const;
+
+    private:
+        const TimeDomain* domain_;      //!< The tracked domain
+        unsigned int seenRevision_;     //!< Revision of the domain on the last change check
+        bool isStale_;                  //!< A flag indicating whether or not a newly tracked domain has been applied
+    };
+}
+
+#endif
@@ -0,0 +1,301 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "TimerWheel.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    TimerWheel::TimerWheel() :
+        freeList_{None},
+        now_{0},
+        pendingMilliseconds_{0.0},
+        count_{0},
+        numScheduled_{0}
+    {
+        slots_.fill(None);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    TimerHandle TimerWheel::schedule(ime::Time delay, ime::Callback<> callback) {
+        assert(callback && "A timer must have a callback");
+
+        std::int32_t index;
+        if (freeList_ != None) {
+            index = freeList_;
+            freeList_ = nodes_[index].prev;
+        } else {
+            index = static_cast<std::int32_t>(nodes_.size());
+            nodes_.emplace_back();
+        }
+
+        Node& node = nodes_[index];
+        node.callback = std::move(callback);
+        node.expiry = now_ + std::max<std::uint64_t>(toTicks(delay), 1);
+        node.status = Status::Scheduled;
+        link(index);
+        count_++;
+
+        TimerHandle handle;
+        handle.index_ = static_cast<std::uint32_t>(index);
+        handle.generation_ = node.generation;
+        return handle;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::cancel(const TimerHandle& handle) {
+        if (Node* node = find(handle)) {
+            auto index = static_cast<std::int32_t>(handle.index_);
+            if (node->status == Status::Scheduled)
+                unlink(index);
+
+            release(index);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::pause(const TimerHandle& handle) {
+        Node* node = find(handle);
+        if (node && node->status == Status::Scheduled) {
+            unlink(static_cast<std::int32_t>(handle.index_));
+            node->expiry -= now_;
+            node->status = Status::Paused;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::resume(const TimerHandle& handle) {
+        Node* node = find(handle);
+        if (node && node->status == Status::Paused) {
+            node->expiry += now_;
+            node->status = Status::Scheduled;
+            link(static_cast<std::int32_t>(handle.index_));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::extend(const TimerHandle& handle, ime::Time duration) {
+        Node* node = find(handle);
+        if (!node)
+            return;
+
+        if (node->status == Status::Paused)
+            node->expiry += toTicks(duration);
+        else {
+            auto index = static_cast<std::int32_t>(handle.index_);
+            unlink(index);
+            node->expiry += toTicks(duration);
+            link(index);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::forceTimeout(const TimerHandle& handle) {
+        if (Node* node = find(handle)) {
+            auto index = static_cast<std::int32_t>(handle.index_);
+            if (node->status == Status::Scheduled)
+                unlink(index);
+
+            ime::Callback<> callback = std::move(node->callback);
+            release(index);
+            callback();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool TimerWheel::isRunning(const TimerHandle& handle) const {
+        const Node* node = find(handle);
+        return node && node->status == Status::Scheduled;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool TimerWheel::isPaused(const TimerHandle& handle) const {
+        const Node* node = find(handle);
+        return node && node->status == Status::Paused;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    ime::Time TimerWheel::getRemainingDuration(const TimerHandle& handle) const {
+        const Node* node = find(handle);
+        if (!node)
+            return ime::Time::Zero;
+
+        std::uint64_t ticks = node->status == Status::Paused ? node->expiry : node->expiry - now_;
+        return ime::milliseconds(static_cast<std::int32_t>(ticks));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t TimerWheel::getCount() const {
+        return count_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::update(ime::Time deltaTime) {
+        pendingMilliseconds_ += static_cast<double>(deltaTime.asSeconds()) * 1000.0;
+        if (pendingMilliseconds_ < 1.0)
+            return;
+
+        double ticks = std::floor(pendingMilliseconds_);
+        pendingMilliseconds_ -= ticks;
+        advance(static_cast<std::uint64_t>(ticks));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::clear() {
+        // The pool is kept so that the generations of outstanding handles stay valid
+        freeList_ = None;
+        for (auto index = static_cast<std::int32_t>(nodes_.size()) - 1; index >= 0; --index) {
+            Node& node = nodes_[index];
+            if (node.status != Status::Free) {
+                node.callback = nullptr;
+                node.status = Status::Free;
+                node.generation++;
+            }
+
+            node.next = node.slot = None;
+            node.prev = freeList_;
+            freeList_ = index;
+        }
+
+        slots_.fill(None);
+        count_ = numScheduled_ = 0;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    TimerWheel::Node* TimerWheel::find(const TimerHandle& handle) {
+        return const_cast<Node*>(static_cast<const TimerWheel&>(*this).find(handle));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const TimerWheel::Node* TimerWheel::find(const TimerHandle& handle) const {
+        if (handle.index_ >= nodes_.size())
+            return nullptr;
+
+        const Node& node = nodes_[handle.index_];
+        if (node.generation != handle.generation_ || node.status == Status::Free)
+            return nullptr;
+
+        return &node;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::link(std::int32_t index) {
+        Node& node = nodes_[index];
+
+        // Timers beyond the range of the wheel are parked in the last slot of
+        // the top level and re-linked with their real expiry when it cascades
+        std::uint64_t delay = std::min(node.expiry - now_, MaxDelay);
+        int level = 0;
+        while (level < NumLevels - 1 && delay >> (SlotBits * (level + 1)))
+            level++;
+
+        auto slot = static_cast<std::int32_t>(level * NumSlots + (((now_ + delay) >> (SlotBits * level)) & SlotMask));
+        node.slot = slot;
+        node.prev = None;
+        node.next = slots_[slot];
+
+        if (node.next != None)
+            nodes_[node.next].prev = index;
+
+        slots_[slot] = index;
+        numScheduled_++;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::unlink(std::int32_t index) {
+        Node& node = nodes_[index];
+
+        if (node.prev != None)
+            nodes_[node.prev].next = node.next;
+        else
+            slots_[node.slot] = node.next;
+
+        if (node.next != None)
+            nodes_[node.next].prev = node.prev;
+
+        node.prev = node.next = node.slot = None;
+        numScheduled_--;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::release(std::int32_t index) {
+        Node& node = nodes_[index];
+        node.callback = nullptr;
+        node.status = Status::Free;
+        node.generation++;
+        node.prev = freeList_;
+        freeList_ = index;
+        count_--;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::advance(std::uint64_t ticks) {
+        for (; ticks > 0; --ticks) {
+            // Nothing can expire, so the slots do not need to be visited
+            if (numScheduled_ == 0) {
+                now_ += ticks;
+                return;
+            }
+
+            now_++;
+
+            for (int level = 1; level < NumLevels; ++level) {
+                if (now_ & ((std::uint64_t{1} << (SlotBits * level)) - 1))
+                    break;
+
+                cascade(level);
+            }
+
+            // Timers are removed one at a time because a callback may cancel
+            // other timers that expire on the same tick
+            std::int32_t& head = slots_[now_ & SlotMask];
+            while (head != None) {
+                std::int32_t index = head;
+                unlink(index);
+
+                ime::Callback<> callback = std::move(nodes_[index].callback);
+                release(index);
+                callback();
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::cascade(int level) {
+        std::int32_t& head = slots_[level * NumSlots + ((now_ >> (SlotBits * level)) & SlotMask)];
+        while (head != None) {
+            std::int32_t index = head;
+            unlink(index);
+            link(index);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint64_t TimerWheel::toTicks(ime::Time time) {
+        float milliseconds = time.asSeconds() * 1000.0f;
+        return milliseconds > 0.0f ? static_cast<std::uint64_t>(std::llround(milliseconds)) : 0;
+    }
+}
@@ -0,0 +1,246 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPERPACMAN_TIMERWHEEL_H
+#define SUPERPACMAN_TIMERWHEEL_H
+
+#include <IME/core/time/Time.h>
+#include <IME/common/Types.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Stable reference to a timer scheduled on a spm::TimerWheel
+     *
+     * A handle remains safe to use after the timer it refers to expires
+     * or is cancelled, operations on such a handle have no effect. A
+     * default constructed handle does not refer to any timer
+     */
+    class TimerHandle {
+    public:
+        /**
+         * @brief Check if the handle was returned by spm::TimerWheel::schedule
+         * @return True if the handle was ever assigned a timer, otherwise false
+         */
+        bool isAssigned() const {
+            return index_ != Unassigned;
+        }
+
+    private:
+        static constexpr std::uint32_t Unassigned = 0xFFFFFFFF;
+        std::uint32_t index_ = Unassigned; //!< Position of the timer in the wheels timer pool
+        std::uint32_t generation_ = 0;     //!< Distinguishes the timer from timers that reused its slot
+        friend class TimerWheel;
+    };
+
+    /**
+     * @brief Hierarchical timing wheel
+     *
+     * The wheel runs one-shot timers with a resolution of one millisecond.
+     * Scheduling, cancelling, pausing and expiring a timer are all O(1)
+     * and timers that are not due cost nothing when the wheel is updated.
+     * Timers are stored in a pool owned by the wheel and referred to with
+     * spm::TimerHandle, so no allocation takes place once the pool has
+     * grown to the number of concurrently active timers
+     *
+     * Timers that expire within the same update are executed in order of
+     * expiry. A timer callback may schedule, cancel, pause or resume any
+     * timer, including the one being executed
+     */
+    class TimerWheel {
+    public:
+        /**
+         * @brief Constructor
+         */
+        TimerWheel();
+
+        /**
+         * @brief Schedule a callback
+         * @param delay How long to wait before executing the callback
+         * @param callback The function to execute when the timer expires
+         * @return A handle to the scheduled timer
+         *
+         * A zero or negative @a delay executes @a callback on the next update
+         */
+        TimerHandle schedule(ime::Time delay, ime::Callback<> callback);
+
+        /**
+         * @brief Stop a timer without executing its callback
+         * @param handle The timer to be cancelled
+         */
+        void cancel(const TimerHandle& handle);
+
+        /**
+         * @brief Pause a running timer
+         * @param handle The timer to be paused
+         *
+         * A paused timer keeps its remaining duration until it is resumed
+         *
+         * @see resume
+         */
+        void pause(const TimerHandle& handle);
+
+        /**
+         * @brief Resume a paused timer
+         * @param handle The timer to be resumed
+         *
+         * @see pause
+         */
+        void resume(const TimerHandle& handle);
+
+        /**
+         * @brief Add time to a running or paused timer
+         * @param handle The timer to be extended
+         * @param duration The time to add to the remaining duration
+         */
+        void extend(const TimerHandle& handle, ime::Time duration);
+
+        /**
+         * @brief Expire a running or paused timer immediately
+         * @param handle The timer to be expired
+         *
+         * The timers callback is executed before this function returns
+         */
+        void forceTimeout(const TimerHandle& handle);
+
+        /**
+         * @brief Check if a timer is counting down
+         * @param handle The timer to be checked
+         * @return True if the timer is scheduled and not paused, otherwise false
+         */
+        bool isRunning(const TimerHandle& handle) const;
+
+        /**
+         * @brief Check if a timer is paused
+         * @param handle The timer to be checked
+         * @return True if the timer is paused, otherwise false
+         */
+        bool isPaused(const TimerHandle& handle) const;
+
+        /**
+         * @brief Get the time left before a timer expires
+         * @param handle The timer to be queried
+         * @return The remaining duration or ime::Time::Zero if the timer
+         *         has expired or was cancelled
+         */
+        ime::Time getRemainingDuration(const TimerHandle& handle) const;
+
+        /**
+         * @brief Get the number of running and paused timers
+         * @return The number of active timers
+         */
+        std::size_t getCount() const;
+
+        /**
+         * @brief Advance the wheel and execute the callbacks of expired timers
+         * @param deltaTime Time passed since last update
+         */
+        void update(ime::Time deltaTime);
+
+        /**
+         * @brief Cancel all timers
+         */
+        void clear();
+
+    private:
+        static constexpr int SlotBits = 6;                        //!< log2 of the number of slots per level
+        static constexpr int NumSlots = 1 << SlotBits;            //!< Number of slots per level
+        static constexpr int NumLevels = 5;                       //!< Number of levels (covers about 12 days)
+        static constexpr std::uint64_t SlotMask = NumSlots - 1;
+        static constexpr std::uint64_t MaxDelay = (std::uint64_t{1} << (SlotBits * NumLevels)) - 1;
+        static constexpr std::int32_t None = -1;
+
+        /**
+         * @brief The state of a timer in the pool
+         */
+        enum class Status : std::uint8_t {
+            Free,       //!< Not in use
+            Scheduled,  //!< Counting down in one of the wheel slots
+            Paused      //!< Not in the wheel, remaining ticks are saved
+        };
+
+        /**
+         * @brief A timer in the pool
+         */
+        struct Node {
+            ime::Callback<> callback;  //!< Function executed when the timer expires
+            std::uint64_t expiry = 0;  //!< Tick at which the timer expires (or remaining ticks when paused)
+            std::uint32_t generation = 0;
+            std::int32_t prev = None;  //!< Previous timer in the same slot (or next free node)
+            std::int32_t next = None;  //!< Next timer in the same slot
+            std::int32_t slot = None;  //!< The slot the timer is in
+            Status status = Status::Free;
+        };
+
+        /**
+         * @brief Get the node a handle refers to
+         * @return The node or a nullptr if the handle is stale
+         */
+        Node* find(const TimerHandle& handle);
+        const Node* find(const TimerHandle& handle) const;
+
+        /**
+         * @brief Insert a scheduled node into the slot matching its expiry
+         */
+        void link(std::int32_t index);
+
+        /**
+         * @brief Remove a scheduled node from its slot
+         */
+        void unlink(std::int32_t index);
+
+        /**
+         * @brief Return a node to the pool
+         */
+        void release(std::int32_t index);
+
+        /**
+         * @brief Advance the wheel by a number of ticks
+         */
+        void advance(std::uint64_t ticks);
+
+        /**
+         * @brief Move the timers in a slot of a higher level to lower levels
+         */
+        void cascade(int level);
+
+        /**
+         * @brief Convert a time to a number of ticks
+         */
+        static std::uint64_t toTicks(ime::Time time);
+
+    private:
+        std::vector<Node> nodes_;                               //!< Timer pool
+        std::array<std::int32_t, NumSlots * NumLevels> slots_;  //!< First timer in each slot
+        std::int32_t freeList_;                                 //!< First unused node in the pool
+        std::uint64_t now_;                                     //!< The current tick
+        double pendingMilliseconds_;                            //!< Time not yet converted to ticks
+        std::size_t count_;                                     //!< Number of scheduled and paused timers
+        std::size_t numScheduled_;                              //!< Number of timers in the wheel
+    };
+}
+
+#endif
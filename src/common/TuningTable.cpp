@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "TuningTable.h"
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    TuningTable::TuningTable() :
+        levels_(DesignedDifficulty)
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    bool TuningTable::loadFromFile(const std::string& filename) {
+        if (filename != filename_) {
+            filename_ = filename;
+            watcher_ = std::make_unique<FileWatcher>(filename);
+        }
+
+        auto file = std::ifstream(filename);
+        if (!file)
+            return false;
+
+        DifficultyTable::Levels levels = DesignedDifficulty;
+        std::vector<std::string> columns;
+        int lastLevel = 0;
+
+        // Levels that are left out take the listed values of the level before them,
+        // the columns that are not listed keep their built-in values
+        auto fillUpTo = [&levels, &columns, &lastLevel](int level) {
+            for (int i = lastLevel + 1; lastLevel > 0 && i <= level; i++) {
+                for (const auto& column : columns)
+                    *levels[i - 1].findValue(column) = *levels[lastLevel - 1].findValue(column);
+            }
+        };
+
+        for (auto line = std::string(); std::getline(file, line);) {
+            auto fields = std::istringstream(line);
+            auto field = std::string();
+            if (!(fields >> field) || field.front() == '#')
+                continue;
+
+            if (columns.empty()) {
+                if (field != "level")
+                    return false;
+
+                auto dummy = LevelTuning();
+                while (fields >> field) {
+                    if (!dummy.findValue(field))
+                        return false;
+
+                    columns.push_back(field);
+                }
+
+                continue;
+            }
+
+            int level = std::atoi(field.c_str());
+            if (level <= lastLevel || level > LevelCount)
+                return false;
+
+            fillUpTo(level - 1);
+            for (const auto& column : columns) {
+                if (!(fields >> *levels[level - 1].findValue(column)))
+                    return false;
+            }
+
+            lastLevel = level;
+        }
+
+        fillUpTo(LevelCount);
+        levels_ = levels;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool TuningTable::reloadIfChanged() {
+        return watcher_ && watcher_->hasChanged() && loadFromFile(filename_);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const LevelTuning& TuningTable::getLevel(int level) const {
+        assert(level >= 1 && level <= LevelCount && "The game ends after the last level");
+        return levels_[level - 1];
+    }
+}
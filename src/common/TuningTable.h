@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_TUNINGTABLE_H
+#define SUPERPACMAN_TUNINGTABLE_H
+
+#include "DifficultyTable.h"
+#include "FileWatcher.h"
+#include <memory>
+#include <string>
+
+namespace spm {
+    /**
+     * @brief Gameplay tuning values of every level
+     *
+     * The table starts out with spm::DesignedDifficulty.
+     * A tuning file overrides them, it has a header line that names its
+     * columns followed by one line per level:
+     *
+     * @code
+     * # Lines that start with '#' are comments
+     * level  frightened  super  chaseSpeed
+     * 1      6           8      1.08
+     * 5      2           4      1.1
+     * @endcode
+     *
+     * The first column is the level. Each other column is the name of a
+     * member of spm::LevelTuning without its "Duration" or "SpeedMultiplier"
+     * suffix, waves are numbered from 0 (scatter0, chase3). Columns that
+     * are left out keep their built-in values and levels that are left
+     * out take the values of the level before them
+     */
+    class TuningTable {
+    public:
+        static constexpr int LevelCount = DifficultyTable::LevelCount; //!< The number of levels in the game
+
+        /**
+         * @brief Constructor
+         *
+         * Fills the table with the values the game was designed with
+         */
+        TuningTable();
+
+        /**
+         * @brief Override the table with a tuning file
+         * @param filename The name of the file preceded by its path
+         * @return True if the file was loaded or false if it could not
+         *         be read or is malformed, in which case the table is
+         *         left unchanged
+         *
+         * The file is watched from then on
+         *
+         * @see reloadIfChanged
+         */
+        bool loadFromFile(const std::string& filename);
+
+        /**
+         * @brief Reload the tuning file if it was written to since it was loaded
+         * @return True if the file was reloaded, otherwise false
+         *
+         * References to the levels of the table remain valid when the file
+         * is reloaded and see the new values. Malformed files are ignored
+         */
+        bool reloadIfChanged();
+
+        /**
+         * @brief Get the tuning values of a level
+         * @param level The level, in the range [1, LevelCount]
+         * @return The tuning values of the level
+         *
+         * The game ends after the last level, so there are no values
+         * beyond it to extend the schedule with
+         */
+        const LevelTuning& getLevel(int level) const;
+
+    private:
+        DifficultyTable::Levels levels_;             //!< Tuning values of each level, the first level is at index 0
+        std::string filename_;                       //!< The name of the tuning file, empty if none was loaded
+        std::unique_ptr<FileWatcher> watcher_;       //!< Watches the tuning file
+    };
+}
+
+#endif
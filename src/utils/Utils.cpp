@@ -24,6 +24,8 @@
 
 #include "Utils.h"
 #include "Common/Constants.h"
+#include "Common/TimeDomain.h"
+#include <IME/core/object/GridObject.h>
 #include <cassert>
 
 namespace spm::utils {
@@ -57,14 +59,22 @@ namespace spm::utils {
 
     ///////////////////////////////////////////////////////////////
     void resetCache(ime::PropertyContainer &cache) {
-        cache.setValue("CURRENT_LEVEL", 1);
-        cache.setValue("CURRENT_SCORE", 0);
-        cache.setValue("PLAYER_LIVES", Constants::PacManLives);
-        cache.setValue("NUM_EXTRA_LIVES_WON", 0);
-        cache.setValue("BONUS_STAGE", 3);
         cache.setValue("PLAYER_WON_GAME", false);
-        cache.setValue("GHOSTS_FRIGHTENED_MODE_DURATION", ime::seconds(Constants::POWER_MODE_DURATION));
-        cache.setValue("PACMAN_SUPER_MODE_DURATION", ime::seconds(Constants::SUPER_MODE_DURATION));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void updateTimescale(ime::GridObject& actor, TimeDomainTracker& movementDomain, TimeDomainTracker& animationDomain) {
+        if (actor.getGridMover() && movementDomain.hasChanged()) {
+            float timescale = movementDomain.getTimescale();
+            actor.getGridMover()->setMovementFreeze(timescale == 0.0f);
+
+            // The speed multiplier is left alone, it is owned by the actors state
+            if (timescale > 0.0f)
+                actor.getGridMover()->setSpeed(ime::Vector2f{Constants::PacManNormalSpeed, Constants::PacManNormalSpeed} * timescale);
+        }
+
+        if (animationDomain.hasChanged())
+            actor.getSprite().getAnimator().setTimescale(animationDomain.getTimescale());
     }
 
 } // namespace spm
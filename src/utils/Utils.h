@@ -32,6 +32,8 @@
  * @brief Defines a bunch of helper functions
  */
 namespace spm {
+    class TimeDomainTracker;
+
     namespace utils {
         /**
          * @brief Get a string representation of ime::Direction
@@ -50,8 +52,22 @@ namespace spm {
         /**
          * @brief Reset the cache to default values
          * @param cache The cache to be reset
+         *
+         * Only the values that are not part of spm::GameSession are reset
          */
         extern void resetCache(ime::PropertyContainer& cache);
+
+        /**
+         * @brief Apply the timescale of an actors time domains to its grid
+         *        mover and animator
+         * @param actor The actor to be updated
+         * @param movementDomain Tracks the domain the actors grid mover belongs to
+         * @param animationDomain Tracks the domain the actors animator belongs to
+         *
+         * Nothing is applied if the timescale of a domain has not changed
+         * since the last call. A timescale of zero freezes the actor
+         */
+        extern void updateTimescale(ime::GridObject& actor, TimeDomainTracker& movementDomain, TimeDomainTracker& animationDomain);
     }
 }
 
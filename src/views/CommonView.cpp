@@ -24,16 +24,36 @@
 
 #include "CommonView.h"
 #include "Common/Constants.h"
-#include <IME/ui/widgets/Label.h>
 #include <IME/ui/widgets/Picture.h>
-#include <IME/ui/widgets/Panel.h>
+#include <charconv>
 
 using namespace ime::ui;
 
 namespace spm {
+    namespace {
+        ///////////////////////////////////////////////////////////////
+        void setNumber(Label& label, int value) {
+            // Short enough for the small string buffer, so no allocation
+            char digits[16] = "00";
+            char* end = digits + 2;
+            if (value != 0)
+                end = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+
+            label.setText(std::string(digits, end));
+        }
+    }
+
     ///////////////////////////////////////////////////////////////
     CommonView::CommonView(GuiContainer &gui) :
         gui_{gui},
+        pnlContainer_{nullptr},
+        lblScoreValue_{nullptr},
+        lblHighScoreValue_{nullptr},
+        score_{0},
+        highScore_{0},
+        isScoreDirty_{false},
+        isHighScoreDirty_{false},
+        level_{0},
         pacmanLives_{0}
     {
         gui_.setFont("namco.ttf");
@@ -42,8 +62,10 @@ namespace spm {
     ///////////////////////////////////////////////////////////////
     void CommonView::init(unsigned int level, unsigned int lives) {
         createWidgets();
-        createLevelIndicatorSprites(level);
-        createPlayerLivesIndicatorSprites(lives);
+        level_ = level;
+        pacmanLives_ = lives;
+        updateLevelIndicatorSprites();
+        updatePlayerLivesIndicatorSprites();
 
         timer_ = ime::Timer::create(ime::milliseconds(200), [this] {
             gui_.getWidget("lblOneUp")->toggleVisibility();
@@ -53,43 +75,46 @@ namespace spm {
 
     ///////////////////////////////////////////////////////////////
     void CommonView::setScore(int score) {
-        gui_.getWidget<Label>("lblScoreValue")
-            ->setText(score == 0 ? "00" : std::to_string(score));
+        isScoreDirty_ |= score != score_;
+        score_ = score;
     }
 
     ///////////////////////////////////////////////////////////////
     void CommonView::setHighScore(int highScore) {
-        gui_.getWidget<Label>("lblHighScoreValue")
-            ->setText(highScore == 0 ? "00" : std::to_string(highScore));
+        isHighScoreDirty_ |= highScore != highScore_;
+        highScore_ = highScore;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void CommonView::setLevel(unsigned int level) {
+        level_ = level;
     }
 
     ///////////////////////////////////////////////////////////////
     void CommonView::createWidgets() {
-        auto* pnlContainer = gui_.addWidget<Panel>(Panel::create(), "pnlContainer");;
-        pnlContainer->getRenderer()->setBackgroundColour(ime::Colour::Transparent);
+        pnlContainer_ = gui_.addWidget<Panel>(Panel::create(), "pnlContainer");;
+        pnlContainer_->getRenderer()->setBackgroundColour(ime::Colour::Transparent);
 
-        auto* lblOneUp = pnlContainer->addWidget<Label>(Label::create("1UP"), "lblOneUp");
+        auto* lblOneUp = pnlContainer_->addWidget<Label>(Label::create("1UP"), "lblOneUp");
         lblOneUp->setPosition("8.3%", "0");
         lblOneUp->getRenderer()->setTextColour(ime::Colour::Red);
 
-        auto lblScoreValue = Label::create("00");
-        lblScoreValue->getRenderer()->setTextColour(ime::Colour::White);
-        lblScoreValue->setPosition("4%", ime::bindBottom(lblOneUp));
-        pnlContainer->addWidget(std::move(lblScoreValue), "lblScoreValue");
+        lblScoreValue_ = pnlContainer_->addWidget<Label>(Label::create("00"), "lblScoreValue");
+        lblScoreValue_->getRenderer()->setTextColour(ime::Colour::White);
+        lblScoreValue_->setPosition("4%", ime::bindBottom(lblOneUp));
 
-        auto* lblHighScore = pnlContainer->addWidget<Label>(Label::create("HIGH SCORE"), "lblHighScore");
+        auto* lblHighScore = pnlContainer_->addWidget<Label>(Label::create("HIGH SCORE"), "lblHighScore");
         lblHighScore->getRenderer()->setTextColour(ime::Colour::Red);
         lblHighScore->setPosition("(&.w - w) / 2", "0");
 
-        auto lblHighScoreValue = Label::create("00");
-        lblHighScoreValue->getRenderer()->setTextColour(ime::Colour::White);
-        lblHighScoreValue->setPosition("(&.w - w) / 2", ime::bindBottom(lblHighScore));
-        pnlContainer->addWidget(std::move(lblHighScoreValue), "lblHighScoreValue");
+        lblHighScoreValue_ = pnlContainer_->addWidget<Label>(Label::create("00"), "lblHighScoreValue");
+        lblHighScoreValue_->getRenderer()->setTextColour(ime::Colour::White);
+        lblHighScoreValue_->setPosition("(&.w - w) / 2", ime::bindBottom(lblHighScore));
 
         auto lblCredit = Label::create("CREDIT 0");
         lblCredit->getRenderer()->setTextColour(ime::Colour::White);
         lblCredit->setPosition("8.3%", "&.h - h");
-        pnlContainer->addWidget(std::move(lblCredit), "lblCredit");
+        pnlContainer_->addWidget(std::move(lblCredit), "lblCredit");
 
         auto lblGetReady = ime::ui::Label::create("Player 1\nReady!!");
         lblGetReady->setVisible(false);
@@ -99,67 +124,88 @@ namespace spm {
         lblGetReady->getRenderer()->setTextColour(ime::Colour::White);
         lblGetReady->getRenderer()->setTextStyle(ime::TextStyle::Italic);
         lblGetReady->setPosition(242, 274);
-        pnlContainer->addWidget(std::move(lblGetReady), "lblReady");
+        pnlContainer_->addWidget(std::move(lblGetReady), "lblReady");
     }
 
     ///////////////////////////////////////////////////////////////
-    void CommonView::createLevelIndicatorSprites(unsigned int level) {
-        auto* pnlContainer = gui_.getWidget<Panel>("pnlContainer");
-
+    void CommonView::updateLevelIndicatorSprites() {
         // Depict the current game level as fruit images
         auto frameSize = ime::Vector2u{16, 16};
         auto startPos = ime::Vector2u{1, 142}; //Top-left position of the first frame on the spritesheet
-        for (auto i = 0u; i < level; ++i) {
+        for (auto i = static_cast<unsigned int>(picFruits_.size()); i < level_; ++i) {
             auto picFruit = Picture::create("spritesheet.png", {startPos.x + (i * (frameSize.x + 1)), startPos.y, frameSize.x, frameSize.y});
             picFruit->setOrigin(1.0f, 1.0f);
             picFruit->scale(0.4f, 0.4f);
             if (i == 0)
-                picFruit->setPosition(pnlContainer->getSize());
+                picFruit->setPosition(pnlContainer_->getSize());
             else {
-                auto pivPrevFruit = pnlContainer->getWidget("picFruit" + std::to_string(i - 1));
+                auto* pivPrevFruit = picFruits_.back();
                 picFruit->setPosition(ime::bindLeft(pivPrevFruit).append("-1%"), std::to_string(pivPrevFruit->getPosition().y));
             }
 
-            pnlContainer->addWidget(std::move(picFruit), "picFruit" + std::to_string(i));
+            picFruits_.push_back(pnlContainer_->addWidget<Picture>(std::move(picFruit), "picFruit" + std::to_string(i)));
         }
+
+        for (; picFruits_.size() > level_; picFruits_.pop_back())
+            gui_.removeWidget("picFruit" + std::to_string(picFruits_.size() - 1));
     }
 
     ///////////////////////////////////////////////////////////////
-    void CommonView::createPlayerLivesIndicatorSprites(unsigned int lives) {
-        for (unsigned int i = 0u; i < lives; ++i)
-            addLife();
+    void CommonView::updatePlayerLivesIndicatorSprites() {
+        auto static frameSize = ime::Vector2u{16, 16};
+        auto static startPos = ime::Vector2u{216, 1}; //Top-left position of the frame on the spritesheet
+
+        while (picLives_.size() < pacmanLives_) {
+            auto name = "picLife" + std::to_string(picLives_.size() + 1);
+            if (picLives_.empty()) {
+                pnlContainer_->getWidget("lblCredit")->setVisible(false);
+                auto* picLife = pnlContainer_->addWidget<Picture>(Picture::create("spritesheet.png", {startPos.x, startPos.y, frameSize.x, frameSize.y}), name);
+                picLife->setOrigin(0.0f, 1.0f);
+                picLife->scale(0.2f, 0.2f);
+                picLife->setPosition(0, pnlContainer_->getSize().y);
+                picLives_.push_back(picLife);
+            } else {
+                auto* picLastAdded = picLives_.back();
+                auto picNewLife  = picLastAdded->clone();
+                picNewLife->setPosition(ime::bindRight(picLastAdded).append("+0.5%"), std::to_string(picLastAdded->getPosition().y));
+                picLives_.push_back(pnlContainer_->addWidget<Widget>(std::move(picNewLife), name));
+            }
+        }
+
+        for (; picLives_.size() > pacmanLives_; picLives_.pop_back())
+            gui_.removeWidget("picLife" + std::to_string(picLives_.size()));
     }
 
     ///////////////////////////////////////////////////////////////
     void CommonView::update(ime::Time deltaTime) {
         timer_->update(deltaTime);
+
+        if (isScoreDirty_) {
+            setNumber(*lblScoreValue_, score_);
+            isScoreDirty_ = false;
+        }
+
+        if (isHighScoreDirty_) {
+            setNumber(*lblHighScoreValue_, highScore_);
+            isHighScoreDirty_ = false;
+        }
+
+        if (picFruits_.size() != level_)
+            updateLevelIndicatorSprites();
+
+        if (picLives_.size() != pacmanLives_)
+            updatePlayerLivesIndicatorSprites();
     }
 
     ///////////////////////////////////////////////////////////////
     void CommonView::addLife() {
-        auto* pnlContainer = gui_.getWidget<Panel>("pnlContainer");
-        auto static frameSize = ime::Vector2u{16, 16};
-        auto static startPos = ime::Vector2u{216, 1}; //Top-left position of the frame on the spritesheet
-
-        if (pacmanLives_ == 0) {
-            pnlContainer->getWidget("lblCredit")->setVisible(false);
-            auto* picLife = pnlContainer->addWidget(Picture::create("spritesheet.png", {startPos.x, startPos.y, frameSize.x, frameSize.y}), "picLife" + std::to_string(++pacmanLives_));
-            picLife->setOrigin(0.0f, 1.0f);
-            picLife->scale(0.2f, 0.2f);
-            picLife->setPosition(0, pnlContainer->getSize().y);
-        } else {
-            auto picLastAdded = pnlContainer->getWidget("picLife" + std::to_string(pacmanLives_));
-            auto picNewLife  = picLastAdded->clone();
-            picNewLife->setPosition(ime::bindRight(picLastAdded).append("+0.5%"), std::to_string(picLastAdded->getPosition().y));
-            pnlContainer->addWidget(std::move(picNewLife), "picLife" + std::to_string(++pacmanLives_));
-        }
+        pacmanLives_++;
     }
 
     ///////////////////////////////////////////////////////////////
     void CommonView::removeLife() {
         if (pacmanLives_ > 0)
-            gui_.removeWidget("picLife" + std::to_string(pacmanLives_--));
+            pacmanLives_--;
     }
 
-
 } // namespace spm
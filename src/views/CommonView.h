@@ -26,7 +26,10 @@
 #define SUPERPACMAN_COMMONVIEW_H
 
 #include <IME/ui/GuiContainer.h>
+#include <IME/ui/widgets/Label.h>
+#include <IME/ui/widgets/Panel.h>
 #include <IME/core/time/Timer.h>
+#include <vector>
 
 namespace spm {
     /**
@@ -38,6 +41,10 @@ namespace spm {
      * and the level fruits at the bottom right of the screen
      *
      * This view is used by all game scenes except the LoadingScene
+     *
+     * Changes to the score, high score, lives and level are recorded and
+     * only applied to the widgets by the next call to update(), so a value
+     * that changes several times in a frame is laid out once
      */
     class CommonView {
     public:
@@ -76,9 +83,22 @@ namespace spm {
          */
         void setHighScore(int highScore);
 
+        /**
+         * @brief Set the level to be depicted
+         * @param level The current game level
+         *
+         * @warning This function must be called after the view is
+         * initialized, otherwise undefined behavior
+         *
+         * @see init
+         */
+        void setLevel(unsigned int level);
+
         /**
          * @brief Update the view
          * @param deltaTime Time passed since view was last updated
+         *
+         * Applies the changes made since the last update to the widgets
          */
         void update(ime::Time deltaTime);
 
@@ -99,21 +119,29 @@ namespace spm {
         void createWidgets();
 
         /**
-         * @brief Create current level fruit depiction
-         * @param level The current game level
+         * @brief Add or remove fruits until the depicted level is up to date
          */
-        void createLevelIndicatorSprites(unsigned int level);
+        void updateLevelIndicatorSprites();
 
         /**
-         * @brief Create current player lives depiction
-         * @param The current number of pacman lives
+         * @brief Add or remove lives until the depicted lives are up to date
          */
-        void createPlayerLivesIndicatorSprites(unsigned int lives);
+        void updatePlayerLivesIndicatorSprites();
 
     private:
-        ime::ui::GuiContainer& gui_;  //!< Container for all widgets
-        ime::Timer::Ptr timer_;       //!< One up text flash Timer
-        unsigned int pacmanLives_;    //!< Records the number of pacman lives after a lives update
+        ime::ui::GuiContainer& gui_;           //!< Container for all widgets
+        ime::ui::Panel* pnlContainer_;         //!< Parent of all the widgets of the view
+        ime::ui::Label* lblScoreValue_;        //!< Displays the score
+        ime::ui::Label* lblHighScoreValue_;    //!< Displays the high score
+        ime::Timer::Ptr timer_;                //!< One up text flash Timer
+        int score_;                            //!< The score to display
+        int highScore_;                        //!< The high score to display
+        bool isScoreDirty_;                    //!< True if the score changed since the last update
+        bool isHighScoreDirty_;                //!< True if the high score changed since the last update
+        unsigned int level_;                   //!< The level to depict
+        unsigned int pacmanLives_;             //!< The number of pacman lives to depict
+        std::vector<ime::ui::Widget*> picFruits_; //!< Depicted level fruits, from right to left
+        std::vector<ime::ui::Widget*> picLives_;  //!< Depicted pacman lives, from left to right
     };
 }
 
@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include "DigitDisplay.h"
+#include <algorithm>
+#include <charconv>
+
+namespace spm {
+    ///////////////////////////////////////////////////////////////
+    DigitDisplay::DigitDisplay(const std::string& atlas, ime::Vector2u glyphSize, unsigned int maxDigits) :
+        atlas_{atlas, glyphSize, ime::Vector2u{1, 1}},
+        digits_(std::max(maxDigits, 1u)),
+        value_{0},
+        isVisible_{true}
+    {
+        for (int digit = 0; digit < 10; ++digit)
+            glyphs_[digit] = *atlas_.getFrame(ime::Index{0, digit});
+
+        for (auto& sprite : digits_)
+            sprite.setTexture(atlas_.getTexture());
+
+        layOutDigits();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void DigitDisplay::addToRenderLayer(ime::RenderLayerContainer& renderLayers, const std::string& renderLayer) {
+        for (auto& sprite : digits_)
+            renderLayers.add(sprite, 0, renderLayer);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void DigitDisplay::setPosition(ime::Vector2f position) {
+        position_ = position;
+        layOutDigits();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void DigitDisplay::setValue(int value) {
+        if (value != value_) {
+            value_ = value;
+            layOutDigits();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void DigitDisplay::setVisible(bool visible) {
+        if (visible != isVisible_) {
+            isVisible_ = visible;
+            layOutDigits();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void DigitDisplay::layOutDigits() {
+        char buffer[16];
+        const char* end = std::to_chars(buffer, buffer + sizeof(buffer), std::max(value_, 0)).ptr;
+        auto numDigits = static_cast<std::size_t>(end - buffer);
+        const char* first = end - std::min(numDigits, digits_.size());
+        numDigits = static_cast<std::size_t>(end - first);
+
+        const ime::UIntRect& glyph = glyphs_[0];
+        float left = position_.x - static_cast<float>(numDigits * glyph.width) / 2.0f;
+        float top = position_.y - static_cast<float>(glyph.height) / 2.0f;
+
+        for (std::size_t i = 0; i < digits_.size(); ++i) {
+            ime::Sprite& sprite = digits_[i];
+            sprite.setVisible(isVisible_ && i < numDigits);
+
+            if (i < numDigits) {
+                sprite.setTextureRect(glyphs_[first[i] - '0']);
+                sprite.setPosition(left + static_cast<float>(i * glyph.width), top);
+            }
+        }
+    }
+
+} // namespace spm
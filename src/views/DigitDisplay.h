@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////
+// Super Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SUPERPACMAN_DIGITDISPLAY_H
+#define SUPERPACMAN_DIGITDISPLAY_H
+
+#include <IME/graphics/Sprite.h>
+#include <IME/graphics/SpriteSheet.h>
+#include <IME/core/scene/RenderLayerContainer.h>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace spm {
+    /**
+     * @brief Draws a number as a row of digit sprites
+     *
+     * The digits come from an atlas of pre-rasterised glyphs made by the
+     * GlyphAtlas tool, so changing the number only changes the texture
+     * rectangles and positions of a few sprites instead of laying out
+     * text. The number is centred on the position of the display
+     */
+    class DigitDisplay {
+    public:
+        /**
+         * @brief Constructor
+         * @param atlas The filename of the digit atlas
+         * @param glyphSize The size of a glyph in the atlas
+         * @param maxDigits The largest number of digits the display shows
+         */
+        DigitDisplay(const std::string& atlas, ime::Vector2u glyphSize, unsigned int maxDigits);
+
+        /**
+         * @brief Copy constructor
+         */
+        DigitDisplay(const DigitDisplay&) = delete;
+
+        /**
+         * @brief Copy assignment operator
+         */
+        DigitDisplay& operator=(const DigitDisplay&) = delete;
+
+        /**
+         * @brief Add the digits to a render layer
+         * @param renderLayers The render layers of the scene the display is drawn in
+         * @param renderLayer The name of the render layer to add the digits to
+         *
+         * The display must outlive the render layer
+         */
+        void addToRenderLayer(ime::RenderLayerContainer& renderLayers, const std::string& renderLayer);
+
+        /**
+         * @brief Set the position of the centre of the number
+         * @param position The new position
+         */
+        void setPosition(ime::Vector2f position);
+
+        /**
+         * @brief Set the number to display
+         * @param value The number to display, negative numbers are shown as 0
+         *
+         * Only the last digits of numbers with more than the maximum
+         * number of digits are shown
+         */
+        void setValue(int value);
+
+        /**
+         * @brief Show or hide the display
+         * @param visible True to show the display, otherwise false
+         */
+        void setVisible(bool visible);
+
+    private:
+        /**
+         * @brief Update the sprites of the digits
+         */
+        void layOutDigits();
+
+    private:
+        ime::SpriteSheet atlas_;              //!< The digit glyphs
+        std::array<ime::UIntRect, 10> glyphs_; //!< The texture rectangle of each digit
+        std::vector<ime::Sprite> digits_;     //!< One sprite per digit, from the most significant
+        ime::Vector2f position_;              //!< The centre of the number
+        int value_;                           //!< The number displayed
+        bool isVisible_;                      //!< True if the display is shown
+    };
+}
+
+#endif